@@ -106,7 +106,7 @@ void SYSTEM_Initialize(void)
 {
     PIN_MANAGER_Initialize();
     CLOCK_Initialize();
-    oledC_setup();
+    oledC_setupStart();
 }
 
 /**
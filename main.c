@@ -2,13 +2,13 @@
   Complete main.c
   - Updates time/date every second via Timer1 ISR.
   - Supports toggling between 24‑hour and 12‑hour display modes using a button on RA11.
-  - Uses a per‑character update method for the time and date.
-  - In 12‑hour mode, after updating the time string, it explicitly clears the 
-    rightmost two columns (columns 94-95) of the time display region to remove
-    any leftover white pixels.
+  - Builds the watch face from retained widgets, one per time and date field.
+    A tick only sets their values; oledC_uiFlush() repaints the widgets that
+    changed into the palettized framebuffer and pushes the damaged rectangles
+    to the OLED once per second.
   
   Note:
-  - This code assumes that the OLED driver APIs (oledC_DrawString, oledC_DrawRectangle, etc.)
+  - This code assumes that the OLED driver APIs (oledC_uiCounter, oledC_uiFlush, etc.)
     are available.
   - The __delay_ms() and __delay_us() functions require inclusion of <libpic30.h>
     and a proper _XTAL_FREQ definition.
@@ -17,14 +17,15 @@
 #include <xc.h>
 #include <stdint.h>
 #include <stdbool.h>
-#include <stdio.h>
-#include <string.h>
+#include <stddef.h>
 #include <libpic30.h>   // For __delay_ms() and __delay_us()
 
 #include "System/system.h"
 #include "oledDriver/oledC.h"
 #include "oledDriver/oledC_colors.h"
 #include "oledDriver/oledC_shapes.h"
+#include "oledDriver/oledC_framebuffer.h"
+#include "oledDriver/oledC_widgets.h"
 
 //---------------------------------------------------------------------
 // Global Time/Date Structure
@@ -105,92 +106,69 @@ static void IncrementTime(void)
 }
 
 //---------------------------------------------------------------------
-// Helper: Per-character update function.
-// Compares newStr with oldStr and only redraws changed characters.
-// Uses a fixed 5x8 font scaled by scale_x and scale_y with 1-pixel spacing.
-// For the last character in the new string, clears only the character width.
-// If the old string is longer than the new one, clears the extra region.
+// Watch face widgets. Each field is its own widget, so a tick only
+// repaints the fields whose value changed.
 //---------------------------------------------------------------------
-static void DrawStringChanged(uint8_t x, uint8_t y, uint8_t scale_x, uint8_t scale_y,
-                                char *newStr, char *oldStr,
-                                uint16_t fgColor, uint16_t bgColor)
+static oledC_widget_t timeRow, hours, minutes, seconds, period, colon1, colon2;
+static oledC_widget_t dateRow, day, month, slash;
+
+static void SetupWatchFace(void)
 {
-    const uint8_t charWidth = 5 * scale_x;
-    const uint8_t spacing = 1;             // Fixed spacing between characters.
-    const uint8_t charHeight = 8 * scale_y;
-    
-    uint8_t newLen = (uint8_t)strlen(newStr);
-    uint8_t oldLen = (uint8_t)strlen(oldStr);
+    // Time "hh:mm:ss" at (2,2) with scale 2 (white on black); the
+    // framebuffer clips the 12-hour suffix at column 95.
+    oledC_setDrawTarget(OLEDC_TARGET_FRAMEBUFFER);
+    oledC_uiInit(OLEDC_COLOR_BLACK);
+    oledC_uiContainer(&timeRow, NULL, 2, 2, OLEDC_UI_ROW, 1);
+    oledC_uiCounter(&hours, &timeRow, 0, 0, 2, 2, OLEDC_COLOR_WHITE);
+    oledC_uiLabel(&colon1, &timeRow, 0, 0, 2, ":", OLEDC_COLOR_WHITE);
+    oledC_uiCounter(&minutes, &timeRow, 0, 0, 2, 2, OLEDC_COLOR_WHITE);
+    oledC_uiLabel(&colon2, &timeRow, 0, 0, 2, ":", OLEDC_COLOR_WHITE);
+    oledC_uiCounter(&seconds, &timeRow, 0, 0, 2, 2, OLEDC_COLOR_WHITE);
+    oledC_uiLabel(&period, &timeRow, 0, 0, 2, "", OLEDC_COLOR_WHITE);
     
-    // For each character in the new string:
-    for (uint8_t i = 0; i < newLen; i++) {
-        char newChar = newStr[i];
-        char oldChar = (i < oldLen) ? oldStr[i] : '\0';
-        if (newChar != oldChar) {
-            uint8_t posX = x + i * (charWidth + spacing);
-            // For the last character, clear only the character width (no extra spacing).
-            uint8_t widthToClear = (i == newLen - 1) ? charWidth : (charWidth + spacing);
-            oledC_DrawRectangle(posX, y, posX + widthToClear - 1, y + charHeight - 1, bgColor);
-            if (newChar != '\0') {
-                char temp[2] = {newChar, '\0'};
-                oledC_DrawString(posX, y, scale_x, scale_y, (uint8_t*)temp, fgColor);
-            }
-        }
-    }
-    // If the old string was longer than the new one, clear the extra region.
-    if (oldLen > newLen) {
-        uint8_t posX = x + newLen * (charWidth + spacing);
-        uint8_t extraWidth = (oldLen - newLen) * (charWidth + spacing) - spacing;
-        oledC_DrawRectangle(posX, y, posX + extraWidth - 1, y + charHeight - 1, bgColor);
-    }
-    // Update the stored old string.
-    strcpy(oldStr, newStr);
+    // Date "dd/mm" at (4,30) with scale 1 (yellow on black).
+    oledC_uiContainer(&dateRow, NULL, 4, 30, OLEDC_UI_ROW, 1);
+    oledC_uiCounter(&day, &dateRow, 0, 0, 1, 2, OLEDC_COLOR_YELLOW);
+    oledC_uiLabel(&slash, &dateRow, 0, 0, 1, "/", OLEDC_COLOR_YELLOW);
+    oledC_uiCounter(&month, &dateRow, 0, 0, 1, 2, OLEDC_COLOR_YELLOW);
 }
 
 //---------------------------------------------------------------------
-// Updated DrawTimeDate: Formats time/date and updates the OLED using
-// per-character update for both time and date.
-// For the time string, after the update, clear the rightmost columns
-// to ensure no extra white line appears when in 12-hour mode.
+// UpdateWatchFace: Sets the widgets from the current time. Only the
+// widgets whose value changed are damaged.
 //---------------------------------------------------------------------
-static void DrawTimeDate(void)
+static void UpdateWatchFace(void)
 {
-    static char lastTimeString[20] = "";
-    static char lastDateString[16] = "";
-    
-    char newTimeString[20];
-    char newDateString[16];
+    uint8_t hour = currentTime.hour;
     
-    // Format the time string.
     if (use12HourFormat)
     {
-        uint8_t hour12 = currentTime.hour % 12;
-        if (hour12 == 0)
-            hour12 = 12;
-        const char *period = (currentTime.hour < 12) ? "AM" : "PM";
-        sprintf(newTimeString, "%02u:%02u:%02u %s", hour12, currentTime.minute, currentTime.second, period);
+        hour = hour % 12;
+        if (hour == 0)
+            hour = 12;
+        oledC_uiSetText(&period, (currentTime.hour < 12) ? " AM" : " PM");
     }
     else
     {
-        sprintf(newTimeString, "%02u:%02u:%02u", currentTime.hour, currentTime.minute, currentTime.second);
-    }
-    
-    // Format the date string.
-    sprintf(newDateString, "%02u/%02u", currentTime.day, currentTime.month);
-    
-    // Update the time display at (2,2) with scale 2 (white on black).
-    DrawStringChanged(2, 2, 2, 2, newTimeString, lastTimeString, OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
-    
-    // --- Extra Patch for 12-hour mode ---
-    // If in 12-hour mode, explicitly clear the rightmost two columns (94 and 95)
-    // in the time display area. For scale 2 and font height 16 (8*2), clear region:
-    if (use12HourFormat) {
-        // Clear columns 94 to 95 for rows from y=2 to y=2+15.
-        oledC_DrawRectangle(94, 2, 95, 2 + (8 * 2) - 1, OLEDC_COLOR_BLACK);
+        oledC_uiSetText(&period, "");
     }
+    oledC_uiSetValue(&hours, hour);
+    oledC_uiSetValue(&minutes, currentTime.minute);
+    oledC_uiSetValue(&seconds, currentTime.second);
+    oledC_uiSetValue(&day, currentTime.day);
+    oledC_uiSetValue(&month, currentTime.month);
+}
+
+//---------------------------------------------------------------------
+// DrawTimeDate: Updates the widgets, then flushes the changed region to
+// the OLED in one pass.
+//---------------------------------------------------------------------
+static void DrawTimeDate(void)
+{
+    UpdateWatchFace();
     
-    // Update the date display at (4,30) with scale 1 (yellow on black).
-    DrawStringChanged(4, 30, 1, 1, newDateString, lastDateString, OLEDC_COLOR_YELLOW, OLEDC_COLOR_BLACK);
+    // Push only what changed.
+    oledC_uiFlush();
 }
 
 //---------------------------------------------------------------------
@@ -208,21 +186,23 @@ void __attribute__((__interrupt__, auto_psv)) _T1Interrupt(void)
 //---------------------------------------------------------------------
 int main(void)
 {
-    // Initialize system (clock, pins, OLED, etc.)
+    // Initialize system (clock, pins) and start the OLED power-up sequence.
     SYSTEM_Initialize();
     
-    // Set OLED boundaries.
-    oledC_setColumnAddressBounds(0, 95);
-    oledC_setRowAddressBounds(0, 95);
+    // While the OLED powers up: build the watch face and render the first
+    // frame into the framebuffer, leaving only the transfer for later.
+    SetupWatchFace();
+    UpdateWatchFace();
+    oledC_composite();
     
-    // Clear the entire OLED screen to black.
-    oledC_startWritingDisplay();
-    for (uint16_t i = 0; i < 96 * 96; i++) {
-        oledC_sendColorInt(OLEDC_COLOR_BLACK);
-    }
-    oledC_stopWritingDisplay();
+    // Wait for the OLED, clear the entire screen to black and push the
+    // first frame.
+    while (!oledC_setupPoll());
+    oledC_clear(OLEDC_COLOR_BLACK);
+    oledC_uiFlush();
     
-    // Initialize Timer1 for 1-second updates.
+    // Start the 1-second updates only now, so the Timer1 ISR never talks
+    // to the panel while it starts up or is being cleared.
     InitializeTimer1();
     
     // Main loop: Poll button on RA11 (active low) to toggle display mode.
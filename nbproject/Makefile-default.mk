@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=oledDriver/oledC.c oledDriver/oledC_shapeHandler.c oledDriver/oledC_shapes.c oledDriver/pin_manager.c spiDriver/spi1_driver.c System/clock.c System/delay.c System/system.c System/traps.c main.c
+SOURCEFILES_QUOTED_IF_SPACED=oledDriver/oledC.c oledDriver/oledC_band.c oledDriver/oledC_damage.c oledDriver/oledC_font.c oledDriver/oledC_fontData.c oledDriver/oledC_framebuffer.c oledDriver/oledC_image.c oledDriver/oledC_screenshot.c oledDriver/oledC_scroll.c oledDriver/oledC_shapeHandler.c oledDriver/oledC_shapes.c oledDriver/oledC_sprite.c oledDriver/oledC_atlasData.c oledDriver/oledC_widgets.c oledDriver/pin_manager.c spiDriver/spi1_driver.c System/clock.c System/delay.c System/system.c System/traps.c main.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/oledDriver/oledC.o ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o ${OBJECTDIR}/oledDriver/oledC_shapes.o ${OBJECTDIR}/oledDriver/pin_manager.o ${OBJECTDIR}/spiDriver/spi1_driver.o ${OBJECTDIR}/System/clock.o ${OBJECTDIR}/System/delay.o ${OBJECTDIR}/System/system.o ${OBJECTDIR}/System/traps.o ${OBJECTDIR}/main.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/oledDriver/oledC.o.d ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o.d ${OBJECTDIR}/oledDriver/oledC_shapes.o.d ${OBJECTDIR}/oledDriver/pin_manager.o.d ${OBJECTDIR}/spiDriver/spi1_driver.o.d ${OBJECTDIR}/System/clock.o.d ${OBJECTDIR}/System/delay.o.d ${OBJECTDIR}/System/system.o.d ${OBJECTDIR}/System/traps.o.d ${OBJECTDIR}/main.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/oledDriver/oledC.o ${OBJECTDIR}/oledDriver/oledC_band.o ${OBJECTDIR}/oledDriver/oledC_damage.o ${OBJECTDIR}/oledDriver/oledC_font.o ${OBJECTDIR}/oledDriver/oledC_fontData.o ${OBJECTDIR}/oledDriver/oledC_framebuffer.o ${OBJECTDIR}/oledDriver/oledC_image.o ${OBJECTDIR}/oledDriver/oledC_screenshot.o ${OBJECTDIR}/oledDriver/oledC_scroll.o ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o ${OBJECTDIR}/oledDriver/oledC_shapes.o ${OBJECTDIR}/oledDriver/oledC_sprite.o ${OBJECTDIR}/oledDriver/oledC_atlasData.o ${OBJECTDIR}/oledDriver/oledC_widgets.o ${OBJECTDIR}/oledDriver/pin_manager.o ${OBJECTDIR}/spiDriver/spi1_driver.o ${OBJECTDIR}/System/clock.o ${OBJECTDIR}/System/delay.o ${OBJECTDIR}/System/system.o ${OBJECTDIR}/System/traps.o ${OBJECTDIR}/main.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/oledDriver/oledC.o.d ${OBJECTDIR}/oledDriver/oledC_band.o.d ${OBJECTDIR}/oledDriver/oledC_damage.o.d ${OBJECTDIR}/oledDriver/oledC_font.o.d ${OBJECTDIR}/oledDriver/oledC_fontData.o.d ${OBJECTDIR}/oledDriver/oledC_framebuffer.o.d ${OBJECTDIR}/oledDriver/oledC_image.o.d ${OBJECTDIR}/oledDriver/oledC_screenshot.o.d ${OBJECTDIR}/oledDriver/oledC_scroll.o.d ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o.d ${OBJECTDIR}/oledDriver/oledC_shapes.o.d ${OBJECTDIR}/oledDriver/oledC_sprite.o.d ${OBJECTDIR}/oledDriver/oledC_atlasData.o.d ${OBJECTDIR}/oledDriver/oledC_widgets.o.d ${OBJECTDIR}/oledDriver/pin_manager.o.d ${OBJECTDIR}/spiDriver/spi1_driver.o.d ${OBJECTDIR}/System/clock.o.d ${OBJECTDIR}/System/delay.o.d ${OBJECTDIR}/System/system.o.d ${OBJECTDIR}/System/traps.o.d ${OBJECTDIR}/main.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/oledDriver/oledC.o ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o ${OBJECTDIR}/oledDriver/oledC_shapes.o ${OBJECTDIR}/oledDriver/pin_manager.o ${OBJECTDIR}/spiDriver/spi1_driver.o ${OBJECTDIR}/System/clock.o ${OBJECTDIR}/System/delay.o ${OBJECTDIR}/System/system.o ${OBJECTDIR}/System/traps.o ${OBJECTDIR}/main.o
+OBJECTFILES=${OBJECTDIR}/oledDriver/oledC.o ${OBJECTDIR}/oledDriver/oledC_band.o ${OBJECTDIR}/oledDriver/oledC_damage.o ${OBJECTDIR}/oledDriver/oledC_font.o ${OBJECTDIR}/oledDriver/oledC_fontData.o ${OBJECTDIR}/oledDriver/oledC_framebuffer.o ${OBJECTDIR}/oledDriver/oledC_image.o ${OBJECTDIR}/oledDriver/oledC_screenshot.o ${OBJECTDIR}/oledDriver/oledC_scroll.o ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o ${OBJECTDIR}/oledDriver/oledC_shapes.o ${OBJECTDIR}/oledDriver/oledC_sprite.o ${OBJECTDIR}/oledDriver/oledC_atlasData.o ${OBJECTDIR}/oledDriver/oledC_widgets.o ${OBJECTDIR}/oledDriver/pin_manager.o ${OBJECTDIR}/spiDriver/spi1_driver.o ${OBJECTDIR}/System/clock.o ${OBJECTDIR}/System/delay.o ${OBJECTDIR}/System/system.o ${OBJECTDIR}/System/traps.o ${OBJECTDIR}/main.o
 
 # Source Files
-SOURCEFILES=oledDriver/oledC.c oledDriver/oledC_shapeHandler.c oledDriver/oledC_shapes.c oledDriver/pin_manager.c spiDriver/spi1_driver.c System/clock.c System/delay.c System/system.c System/traps.c main.c
+SOURCEFILES=oledDriver/oledC.c oledDriver/oledC_band.c oledDriver/oledC_damage.c oledDriver/oledC_font.c oledDriver/oledC_fontData.c oledDriver/oledC_framebuffer.c oledDriver/oledC_image.c oledDriver/oledC_screenshot.c oledDriver/oledC_scroll.c oledDriver/oledC_shapeHandler.c oledDriver/oledC_shapes.c oledDriver/oledC_sprite.c oledDriver/oledC_atlasData.c oledDriver/oledC_widgets.c oledDriver/pin_manager.c spiDriver/spi1_driver.c System/clock.c System/delay.c System/system.c System/traps.c main.c
 
 
 
@@ -95,6 +95,54 @@ ${OBJECTDIR}/oledDriver/oledC.o: oledDriver/oledC.c  .generated_files/flags/defa
 	@${RM} ${OBJECTDIR}/oledDriver/oledC.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC.c  -o ${OBJECTDIR}/oledDriver/oledC.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
 	
+${OBJECTDIR}/oledDriver/oledC_band.o: oledDriver/oledC_band.c  .generated_files/flags/default/03880b83ae5617e7a598def765d5052ec06a8e71 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_band.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_band.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_band.c  -o ${OBJECTDIR}/oledDriver/oledC_band.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_band.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_damage.o: oledDriver/oledC_damage.c  .generated_files/flags/default/3a75320dfaf25db5feee48c872e59fe60309cc2d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_damage.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_damage.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_damage.c  -o ${OBJECTDIR}/oledDriver/oledC_damage.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_damage.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_font.o: oledDriver/oledC_font.c  .generated_files/flags/default/cd80eedd02411183b35b01fabdc77971213059b1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_font.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_font.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_font.c  -o ${OBJECTDIR}/oledDriver/oledC_font.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_font.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_fontData.o: oledDriver/oledC_fontData.c  .generated_files/flags/default/015bd0178d99cebc89bf58e3c7f44b8d9fc468e2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fontData.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fontData.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_fontData.c  -o ${OBJECTDIR}/oledDriver/oledC_fontData.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_fontData.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_framebuffer.o: oledDriver/oledC_framebuffer.c  .generated_files/flags/default/14c063bc6fb5ed94e007d0fd943b8d55892cc457 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_framebuffer.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_framebuffer.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_framebuffer.c  -o ${OBJECTDIR}/oledDriver/oledC_framebuffer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_framebuffer.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_image.o: oledDriver/oledC_image.c  .generated_files/flags/default/11b051013d813aee09408ea8d55b52c3ede305d1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_image.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_image.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_image.c  -o ${OBJECTDIR}/oledDriver/oledC_image.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_image.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_scroll.o: oledDriver/oledC_scroll.c  .generated_files/flags/default/e391646a3fe74a935d6ae82dfb8124787d081afc .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_scroll.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_scroll.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_scroll.c  -o ${OBJECTDIR}/oledDriver/oledC_scroll.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_scroll.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_screenshot.o: oledDriver/oledC_screenshot.c  .generated_files/flags/default/8f22e15c02877fe3d11f0e5ac0ec970fd6f98768 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_screenshot.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_screenshot.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_screenshot.c  -o ${OBJECTDIR}/oledDriver/oledC_screenshot.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_screenshot.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
 ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o: oledDriver/oledC_shapeHandler.c  .generated_files/flags/default/50fead975f43b5b19cca25327b8a947f7cfc82ad .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/oledDriver" 
 	@${RM} ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o.d 
@@ -107,6 +155,24 @@ ${OBJECTDIR}/oledDriver/oledC_shapes.o: oledDriver/oledC_shapes.c  .generated_fi
 	@${RM} ${OBJECTDIR}/oledDriver/oledC_shapes.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_shapes.c  -o ${OBJECTDIR}/oledDriver/oledC_shapes.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_shapes.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
 	
+${OBJECTDIR}/oledDriver/oledC_sprite.o: oledDriver/oledC_sprite.c  .generated_files/flags/default/93e6bc0d3a3c7d71fa3a0d03a9b69bd9da5fe4a4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_sprite.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_sprite.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_sprite.c  -o ${OBJECTDIR}/oledDriver/oledC_sprite.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_sprite.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_atlasData.o: oledDriver/oledC_atlasData.c  .generated_files/flags/default/bb7a97a88164c216ec54ca3116b5df5ff97dd653 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_atlasData.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_atlasData.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_atlasData.c  -o ${OBJECTDIR}/oledDriver/oledC_atlasData.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_atlasData.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_widgets.o: oledDriver/oledC_widgets.c  .generated_files/flags/default/04ca3a5cbd339af92e57cd9ca29411e5efadafa5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_widgets.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_widgets.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_widgets.c  -o ${OBJECTDIR}/oledDriver/oledC_widgets.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_widgets.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
 ${OBJECTDIR}/oledDriver/pin_manager.o: oledDriver/pin_manager.c  .generated_files/flags/default/4d0bee79856264a9e06f7baed6d5fc56f7919a0e .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/oledDriver" 
 	@${RM} ${OBJECTDIR}/oledDriver/pin_manager.o.d 
@@ -156,6 +222,54 @@ ${OBJECTDIR}/oledDriver/oledC.o: oledDriver/oledC.c  .generated_files/flags/defa
 	@${RM} ${OBJECTDIR}/oledDriver/oledC.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC.c  -o ${OBJECTDIR}/oledDriver/oledC.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
 	
+${OBJECTDIR}/oledDriver/oledC_band.o: oledDriver/oledC_band.c  .generated_files/flags/default/795ee259c515533b6b5a1955dbdfe4ab6f1c3960 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_band.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_band.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_band.c  -o ${OBJECTDIR}/oledDriver/oledC_band.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_band.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_damage.o: oledDriver/oledC_damage.c  .generated_files/flags/default/e30c150d1a99539a36d964dbf40a63fddf912f50 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_damage.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_damage.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_damage.c  -o ${OBJECTDIR}/oledDriver/oledC_damage.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_damage.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_font.o: oledDriver/oledC_font.c  .generated_files/flags/default/510a3035584295457adfd97f93a9c43340866c9c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_font.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_font.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_font.c  -o ${OBJECTDIR}/oledDriver/oledC_font.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_font.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_fontData.o: oledDriver/oledC_fontData.c  .generated_files/flags/default/116e736dbdedc78dd384c2c705f56627e753eadd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fontData.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fontData.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_fontData.c  -o ${OBJECTDIR}/oledDriver/oledC_fontData.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_fontData.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_framebuffer.o: oledDriver/oledC_framebuffer.c  .generated_files/flags/default/b697ad3d8171c36a0c3b084037d8ef675f48e1bd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_framebuffer.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_framebuffer.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_framebuffer.c  -o ${OBJECTDIR}/oledDriver/oledC_framebuffer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_framebuffer.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_image.o: oledDriver/oledC_image.c  .generated_files/flags/default/e3dcf634f7559f266293e07e10b53ea177f099b3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_image.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_image.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_image.c  -o ${OBJECTDIR}/oledDriver/oledC_image.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_image.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_scroll.o: oledDriver/oledC_scroll.c  .generated_files/flags/default/70917999cd2047580f4e1ce1a72932e35a9e78a7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_scroll.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_scroll.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_scroll.c  -o ${OBJECTDIR}/oledDriver/oledC_scroll.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_scroll.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_screenshot.o: oledDriver/oledC_screenshot.c  .generated_files/flags/default/1fdd0285a196db4d21110e4fefc96604a92897e4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_screenshot.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_screenshot.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_screenshot.c  -o ${OBJECTDIR}/oledDriver/oledC_screenshot.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_screenshot.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
 ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o: oledDriver/oledC_shapeHandler.c  .generated_files/flags/default/512eaf18740ba1b098a6a201af33bbef7b47583e .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/oledDriver" 
 	@${RM} ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o.d 
@@ -168,6 +282,24 @@ ${OBJECTDIR}/oledDriver/oledC_shapes.o: oledDriver/oledC_shapes.c  .generated_fi
 	@${RM} ${OBJECTDIR}/oledDriver/oledC_shapes.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_shapes.c  -o ${OBJECTDIR}/oledDriver/oledC_shapes.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_shapes.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
 	
+${OBJECTDIR}/oledDriver/oledC_sprite.o: oledDriver/oledC_sprite.c  .generated_files/flags/default/fec4a8f46747a88c9be80fae25dc4cbcbdc60323 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_sprite.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_sprite.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_sprite.c  -o ${OBJECTDIR}/oledDriver/oledC_sprite.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_sprite.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_atlasData.o: oledDriver/oledC_atlasData.c  .generated_files/flags/default/1dcee7f2d2864f7c5863e3fc28b276306e2f4cc5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_atlasData.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_atlasData.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_atlasData.c  -o ${OBJECTDIR}/oledDriver/oledC_atlasData.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_atlasData.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
+${OBJECTDIR}/oledDriver/oledC_widgets.o: oledDriver/oledC_widgets.c  .generated_files/flags/default/6ad18e0b2e35f747554f7a0f5af37af508297f83 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_widgets.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_widgets.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_widgets.c  -o ${OBJECTDIR}/oledDriver/oledC_widgets.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_widgets.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off   
+	
 ${OBJECTDIR}/oledDriver/pin_manager.o: oledDriver/pin_manager.c  .generated_files/flags/default/7a5a2484549d84e0883d5fd7a0c6641a886d58cc .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/oledDriver" 
 	@${RM} ${OBJECTDIR}/oledDriver/pin_manager.o.d 
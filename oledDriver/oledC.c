@@ -25,17 +25,34 @@
 #include "../spiDriver/spi1_driver.h"
 #include "oledC.h"
 #include "pin_manager.h"
-#include "../system/delay.h"
 
 enum STREAMING_MODES 
 {
     NOSTREAM, WRITESTREAM, READSTREAM
 };
 static uint8_t streamingMode = NOSTREAM;
+/* true while a write session keeps SPI1 enabled between pixels */
+static bool sessionHeld = false;
+static void (*transferDoneCallback)(void);
+
+/* Shadow of the panel address window and of the GRAM pointer, i.e. where the
+ * next written or read pixel lands. Column/row commands reset the pointer to
+ * the window start; pixel data advances it in horizontal increment mode. */
+static struct
+{
+    uint8_t colMin, colMax, rowMin, rowMax;
+    uint8_t col, row;
+    bool colValid, rowValid;
+} window;
+/* last value sent to the remap register, bit 0 selects vertical increment */
+static uint8_t remapValue;
+static bool remapValid = false;
 
 static void startStreamingIfNeeded(OLEDC_COMMAND cmd);
 static void stopStreaming(void);
+static void releaseSession(void);
 static uint16_t exchangeTwoBytes(uint8_t byte1, uint8_t byte2);
+static void advancePointer(uint16_t count);
 
 oledc_color_t oledC_parseIntToRGB(uint16_t raw)
 {
@@ -60,6 +77,27 @@ uint16_t oledC_parseRGBToInt(uint8_t red, uint8_t green, uint8_t blue)
     return (((uint16_t)byte1) << 8) | byte2;
 }
 
+uint8_t oledC_closestColor(const uint16_t *palette, uint16_t count, uint16_t color)
+{
+    uint16_t i, distance, bestDistance = 0xFFFF;
+    uint8_t best = 0;
+    int8_t dr, dg, db;
+    for(i = 0; i < count; i++)
+    {
+        dr = (int8_t)(palette[i] >> 11) - (int8_t)(color >> 11);
+        dg = (int8_t)((palette[i] >> 5) & 0x3F) - (int8_t)((color >> 5) & 0x3F);
+        db = (int8_t)(palette[i] & 0x1F) - (int8_t)(color & 0x1F);
+        /* a step of the 5-bit red and blue fields is two green steps */
+        distance = 4*dr*dr + dg*dg + 4*db*db;
+        if(distance < bestDistance)
+        {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
 static void startStreamingIfNeeded(OLEDC_COMMAND cmd)
 {
     if(cmd == OLEDC_CMD_WRITE_RAM || cmd == OLEDC_CMD_READ_RAM)
@@ -74,23 +112,61 @@ static void startStreamingIfNeeded(OLEDC_COMMAND cmd)
 
 static void stopStreaming(void)
 {
+    releaseSession();
     streamingMode = NOSTREAM;
 }
 
+static void releaseSession(void)
+{
+    if(sessionHeld)
+    {
+        spi1_close();
+        sessionHeld = false;
+    }
+}
+
+static void advancePointer(uint16_t count)
+{
+    uint8_t width, height;
+    uint32_t offset;
+    if(!window.colValid || !window.rowValid)
+    {
+        return;
+    }
+    width = window.colMax - window.colMin + 1;
+    height = window.rowMax - window.rowMin + 1;
+    if(remapValid && (remapValue & 0x01))
+    {
+        offset = (uint16_t)(window.col - window.colMin) * height + (window.row - window.rowMin);
+        offset = (offset + count) % ((uint16_t)width * height);
+        window.col = window.colMin + offset / height;
+        window.row = window.rowMin + offset % height;
+        return;
+    }
+    offset = (uint16_t)(window.row - window.rowMin) * width + (window.col - window.colMin);
+    offset = (offset + count) % ((uint16_t)width * height);
+    window.row = window.rowMin + offset / width;
+    window.col = window.colMin + offset % width;
+}
+
 static uint16_t exchangeTwoBytes(uint8_t byte1, uint8_t byte2)
 {
-    if(!oledC_open())
+    if(!sessionHeld && !oledC_open())
     {
         return 0xFFFF;
     }
     byte1 = spi1_exchangeByte(byte1);
     byte2 = spi1_exchangeByte(byte2);
-    spi1_close();
+    if(!sessionHeld)
+    {
+        spi1_close();
+    }
     return ((uint16_t)byte1) << 8 | byte2;
 }
 
 void oledC_sendCommand(OLEDC_COMMAND cmd, uint8_t *payload, uint8_t payload_size)
 {
+    releaseSession();
     if(!oledC_open())
     {
         return;
@@ -107,6 +183,12 @@ void oledC_sendCommand(OLEDC_COMMAND cmd, uint8_t *payload, uint8_t payload_size
     LATCbits.LATC9 = 1; /* set oledC_nCS output high */
     spi1_close();
     startStreamingIfNeeded(cmd);
+    if(cmd == OLEDC_CMD_SET_REMAP_DUAL_COM_LINE_MODE)
+    {
+        oledC_invalidateWindow();
+        remapValid = payload_size > 0;
+        remapValue = remapValid ? payload[0] : 0;
+    }
 }
 
 void oledC_setRowAddressBounds(uint8_t min, uint8_t max)
@@ -114,18 +196,63 @@ void oledC_setRowAddressBounds(uint8_t min, uint8_t max)
     uint8_t payload[2];
     payload[0] = min > 95 ? 95 : min;
     payload[1] = max > 95 ? 95 : max;
+    if(OLEDC_ADDRESS_SHADOW && window.rowValid && window.rowMin == payload[0] && window.rowMax == payload[1] && window.row == payload[0])
+    {
+        return;
+    }
     oledC_sendCommand(OLEDC_CMD_SET_ROW_ADDRESS, payload, 2);
-    
+    window.rowMin = window.row = payload[0];
+    window.rowMax = payload[1];
+    window.rowValid = true;
 }
 
 void oledC_setColumnAddressBounds(uint8_t min, uint8_t max)
 {
     min = min > 95 ? 95 : min;
     max = max > 95 ? 95 : max;
+    if(OLEDC_ADDRESS_SHADOW && window.colValid && window.colMin == min && window.colMax == max && window.col == min)
+    {
+        return;
+    }
     uint8_t payload[2];
     payload[0] = 16+min;
     payload[1] = max + 16;
     oledC_sendCommand(OLEDC_CMD_SET_COLUMN_ADDRESS, payload, 2);
+    window.colMin = window.col = min;
+    window.colMax = max;
+    window.colValid = true;
+}
+
+void oledC_setPixelAddress(uint8_t x, uint8_t y)
+{
+    if(!OLEDC_ADDRESS_SHADOW || !window.colValid || window.col != x)
+    {
+        oledC_setColumnAddressBounds(x, 95);
+    }
+    if(!OLEDC_ADDRESS_SHADOW || !window.rowValid || window.row != y)
+    {
+        oledC_setRowAddressBounds(y, 95);
+    }
+}
+
+void oledC_invalidateWindow(void)
+{
+    window.colValid = false;
+    window.rowValid = false;
+}
+
+void oledC_setVerticalIncrement(bool vertical)
+{
+    uint8_t payload[1];
+    if(!remapValid)
+    {
+        return;
+    }
+    payload[0] = vertical ? (remapValue | 0x01) : (remapValue & ~0x01);
+    if(payload[0] != remapValue)
+    {
+        oledC_sendCommand(OLEDC_CMD_SET_REMAP_DUAL_COM_LINE_MODE, payload, 1);
+    }
 }
 
 void oledC_setSleepMode(bool on)
@@ -164,9 +291,45 @@ uint16_t oledC_readColor(void)
     {
         return 0xFFFF;
     }
+    advancePointer(1);
     return exchangeTwoBytes(0xFF, 0xFF);
 }
 
+void oledC_readRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t *pixels)
+{
+    uint16_t count;
+    end_x = end_x > 95 ? 95 : end_x;
+    end_y = end_y > 95 ? 95 : end_y;
+    if(start_x > end_x || start_y > end_y)
+    {
+        return;
+    }
+    count = (uint16_t)(end_x - start_x + 1) * (end_y - start_y + 1);
+    oledC_setColumnAddressBounds(start_x, end_x);
+    oledC_setRowAddressBounds(start_y, end_y);
+    oledC_readPixels(pixels, count);
+}
+
+void oledC_readPixels(uint16_t *pixels, uint16_t count)
+{
+    uint16_t i;
+    oledC_startReadingDisplay();
+    if(streamingMode != READSTREAM || !oledC_open())
+    {
+        oledC_stopReadingDisplay();
+        return;
+    }
+    /* one SPI session for the whole block, bytes arrive MSB first */
+    spi1_readBlock(pixels, (size_t)count * 2);
+    spi1_close();
+    for(i = 0; i < count; i++)
+    {
+        pixels[i] = (pixels[i] << 8) | (pixels[i] >> 8);
+    }
+    advancePointer(count);
+    oledC_stopReadingDisplay();
+}
+
 void oledC_startWritingDisplay(void)
 {
     oledC_sendCommand(OLEDC_CMD_WRITE_RAM, NULL, 0);    
@@ -176,6 +339,7 @@ void oledC_startWritingDisplay(void)
 
 void oledC_stopWritingDisplay(void)
 {
+    spi1_dmaWait();
     LATCbits.LATC9 = 1; /* set oledC_nCS output high */
     LATCbits.LATC3 = 0; /* set oledC_DC output low */
     stopStreaming();
@@ -188,35 +352,280 @@ void oledC_sendColor(uint8_t r, uint8_t g, uint8_t b)
 
 void oledC_sendColorInt(uint16_t raw)
 {
+    oledC_sendColorRun(raw, 1);
+}
+
+bool oledC_beginWriteSession(void)
+{
+    /* a pending DMA send ends its RAM write when it completes */
+    spi1_dmaWait();
     if(streamingMode != WRITESTREAM)
     {
         oledC_startWritingDisplay();
     }
     if(streamingMode != WRITESTREAM)
+    {
+        return false;
+    }
+    if(!sessionHeld)
+    {
+        sessionHeld = spi1_open(SPI1_WORD_FIFO);
+    }
+    return sessionHeld;
+}
+
+void oledC_endWriteSession(void)
+{
+    oledC_stopWritingDisplay();
+}
+
+void oledC_sendColorRun(uint16_t color, uint16_t count)
+{
+    bool oneShot = !sessionHeld;
+    if(!oledC_beginWriteSession())
     {
         return;
     }
-    exchangeTwoBytes(raw >> 8, raw & 0x00FF);
+    spi1_writeWordRepeat(color, count);
+    advancePointer(count);
+    if(oneShot)
+    {
+        releaseSession();
+    }
+}
+
+void oledC_sendPixels(const uint16_t *pixels, uint16_t count)
+{
+    bool oneShot = !sessionHeld;
+    if(!oledC_beginWriteSession())
+    {
+        return;
+    }
+    spi1_writeWords(pixels, count);
+    advancePointer(count);
+    if(oneShot)
+    {
+        releaseSession();
+    }
+}
+
+/* SPI1 handler that was installed before a DMA transfer took it over */
+static void (*savedSpiISR)(void);
+
+static void finishTransfer(void)
+{
+    oledC_stopWritingDisplay();
+    if(transferDoneCallback)
+    {
+        transferDoneCallback();
+    }
+}
+
+static void transferDone(void)
+{
+    spi1_setSpiISR(savedSpiISR);
+    finishTransfer();
+}
+
+static void hookTransferDone(void)
+{
+    savedSpiISR = spi1_getSpiISR();
+    spi1_setSpiISR(transferDone);
+}
+
+static bool startTransfer(void)
+{
+    if(spi1_dmaBusy())
+    {
+        return false;
+    }
+    releaseSession();
+    if(streamingMode != WRITESTREAM)
+    {
+        oledC_startWritingDisplay();
+    }
+    return streamingMode == WRITESTREAM;
+}
+
+bool oledC_sendPixelsAsync(const uint16_t *pixels, uint16_t count)
+{
+    if(count == 0 || !startTransfer())
+    {
+        return false;
+    }
+    if(!spi1_dmaCanRead(pixels, count))
+    {
+        /* not in data RAM: send it with the CPU and report done right away */
+        oledC_sendPixels(pixels, count);
+        finishTransfer();
+        return true;
+    }
+    hookTransferDone();
+    if(!spi1_dmaWriteWords(pixels, count))
+    {
+        spi1_setSpiISR(savedSpiISR);
+        return false;
+    }
+    advancePointer(count);
+    return true;
+}
+
+bool oledC_sendColorRunAsync(uint16_t color, uint16_t count)
+{
+    if(count == 0 || !startTransfer())
+    {
+        return false;
+    }
+    hookTransferDone();
+    if(!spi1_dmaFillWords(color, count))
+    {
+        spi1_setSpiISR(savedSpiISR);
+        return false;
+    }
+    advancePointer(count);
+    return true;
+}
+
+bool oledC_isTransferBusy(void)
+{
+    return spi1_dmaBusy();
+}
+
+void oledC_setTransferDoneCallback(void (*callback)(void))
+{
+    transferDoneCallback = callback;
 }
 
 bool oledC_open(void){
-    return spi1_open();
+    return spi1_open(SPI1_DEFAULT);
 }
 
-void oledC_setup(void)
+/* Non-blocking bring-up: each step runs an action and then waits on the
+ * free-running Timer2 (FCY / 256) before the next one may start. A step
+ * starts anywhere inside a tick, so one extra tick makes the wait at least
+ * the requested time (the 2 us reset pulse becomes one full tick). */
+#define SETUP_TICKS(us) ((uint16_t)(((uint32_t)(us) * (FCY / 256) + 999999UL) / 1000000UL + 1))
+
+static void setupPins(void)
 {
     LATCbits.LATC8 = 0; /* set oledC_EN output low */
     LATAbits.LATA13 = 1; /* set oledC_RST output high */
     LATCbits.LATC1 = 0; /* set oledC_RW output low */
-    DELAY_milliseconds(1);
+}
+
+static void setupResetLow(void)
+{
     LATAbits.LATA13 = 0; /* set oledC_RST output low */
-    DELAY_microseconds(2);
+}
+
+static void setupResetRelease(void)
+{
     LATAbits.LATA13 = 1; /* set oledC_RST output high */
     LATCbits.LATC8 = 1; /* set oledC_EN output high */
-    DELAY_milliseconds(1);
+}
+
+static void setupWake(void)
+{
     oledC_setSleepMode(false);
-    DELAY_milliseconds(200);
+}
+
+static void setupWindow(void)
+{
     oledC_setColumnAddressBounds(0, 95);
     oledC_setRowAddressBounds(0, 95);
     oledC_setDisplayOrientation();
 }
+
+static const struct
+{
+    void (*action)(void);
+    uint16_t waitTicks;
+} setupSteps[] = {
+    {setupPins, SETUP_TICKS(1000)},
+    {setupResetLow, SETUP_TICKS(2)},
+    {setupResetRelease, SETUP_TICKS(1000)},
+    {setupWake, SETUP_TICKS(200000)},
+    {setupWindow, 0},
+};
+#define SETUP_STEP_COUNT (sizeof(setupSteps) / sizeof(setupSteps[0]))
+
+/* setupStep runs 0..SETUP_STEP_COUNT, where the panel is ready */
+#define SETUP_NOT_STARTED 0xFF
+static uint8_t setupStep = SETUP_NOT_STARTED;
+static uint16_t setupStepStart;
+#ifdef OLEDC_SETUP_TRACE
+static uint16_t setupTrace[SETUP_STEP_COUNT];
+#endif
+
+static void runSetupStep(void)
+{
+    setupStepStart = TMR2;
+#ifdef OLEDC_SETUP_TRACE
+    setupTrace[setupStep] = setupStepStart;
+#endif
+    setupSteps[setupStep].action();
+}
+
+void oledC_setupStart(void)
+{
+    oledC_invalidateWindow();
+    T2CON = 0;
+    T2CONbits.TCKPS = 3; /* 1:256 prescaler */
+    PR2 = 0xFFFF;
+    TMR2 = 0;
+    T2CONbits.TON = 1;
+    setupStep = 0;
+    runSetupStep();
+}
+
+bool oledC_setupPoll(void)
+{
+    if(setupStep == SETUP_NOT_STARTED)
+    {
+        return false;
+    }
+    if(setupStep >= SETUP_STEP_COUNT)
+    {
+        return true;
+    }
+    if((uint16_t)(TMR2 - setupStepStart) < setupSteps[setupStep].waitTicks)
+    {
+        return false;
+    }
+    setupStep++;
+    if(setupStep >= SETUP_STEP_COUNT)
+    {
+        T2CONbits.TON = 0;
+        return true;
+    }
+    runSetupStep();
+    return false;
+}
+
+bool oledC_isReady(void)
+{
+    return setupStep == SETUP_STEP_COUNT;
+}
+
+#ifdef OLEDC_SETUP_TRACE
+uint8_t oledC_getSetupTrace(const uint16_t **ticks)
+{
+    *ticks = setupTrace;
+    return SETUP_STEP_COUNT;
+}
+#endif
+
+void oledC_setup(void)
+{
+    oledC_setupStart();
+    while(!oledC_setupPoll());
+}
+
+void oledC_clear(uint16_t color)
+{
+    oledC_setColumnAddressBounds(0, 95);
+    oledC_setRowAddressBounds(0, 95);
+    oledC_beginWriteSession();
+    oledC_sendColorRun(color, 96 * 96);
+    oledC_endWriteSession();
+}
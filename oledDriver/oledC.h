@@ -66,20 +66,70 @@ typedef enum OLEDC_CMDS
 
 void oledC_sendCommand(OLEDC_COMMAND cmd, uint8_t *payload, uint8_t payload_size);
 
+/* The driver remembers the address window and GRAM pointer it last set and
+ * skips column / row commands that would not change them. Build with
+ * OLEDC_ADDRESS_SHADOW=0 to always send them, e.g. to measure the saving. */
+#ifndef OLEDC_ADDRESS_SHADOW
+#define OLEDC_ADDRESS_SHADOW 1
+#endif
+
 void oledC_setRowAddressBounds(uint8_t min, uint8_t max);
 void oledC_setColumnAddressBounds(uint8_t min, uint8_t max);
+/* Point the GRAM pointer at (x, y), sending only the commands that are needed */
+void oledC_setPixelAddress(uint8_t x, uint8_t y);
+/* Forget the cached address window, e.g. after talking to the panel directly */
+void oledC_invalidateWindow(void);
 void oledC_setSleepMode(bool on);
 void oledC_setDisplayOrientation(void);
+/* Switches GRAM writes between row-by-row and column-by-column order; only
+ * sends the remap command when the mode actually changes */
+void oledC_setVerticalIncrement(bool vertical);
 
 void oledC_startReadingDisplay(void);
 void oledC_stopReadingDisplay(void);
 uint16_t oledC_readColor(void);
+/* Reads a block of GRAM row by row into pixels (width * height entries) */
+void oledC_readRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t *pixels);
+/* Reads count pixels from the GRAM pointer on, in the current window */
+void oledC_readPixels(uint16_t *pixels, uint16_t count);
 
 bool oledC_open(void);
+/* Blocking bring-up, same as oledC_setupStart() followed by polling */
 void oledC_setup(void);
+/* Non-blocking bring-up: start it, keep initializing the rest of the
+ * system and call oledC_setupPoll() until it returns true. Uses Timer2. */
+void oledC_setupStart(void);
+bool oledC_setupPoll(void);
+/* False until a started bring-up has finished */
+bool oledC_isReady(void);
+#ifdef OLEDC_SETUP_TRACE
+/* Timer2 stamp (FCY / 256) at the start of every bring-up step */
+uint8_t oledC_getSetupTrace(const uint16_t **ticks);
+#endif
+/* Fills the whole panel through one address window */
+void oledC_clear(uint16_t color);
 void oledC_sendColor(uint8_t r, uint8_t g, uint8_t b);
 void oledC_sendColorInt(uint16_t raw);
+/* Index of the palette entry closest to a 5/6/5 colour */
+uint8_t oledC_closestColor(const uint16_t *palette, uint16_t count, uint16_t color);
 void oledC_startWritingDisplay(void);
 void oledC_stopWritingDisplay(void);
 
+/* Write session: keeps SPI1 enabled across a whole RAM-write burst.
+ * Any command (e.g. a new address window) ends the session. */
+bool oledC_beginWriteSession(void);
+void oledC_endWriteSession(void);
+void oledC_sendColorRun(uint16_t color, uint16_t count);
+void oledC_sendPixels(const uint16_t *pixels, uint16_t count);
+
+/* DMA variants: return at once and end the RAM write when the transfer is done.
+ * pixels must stay valid until then; any other panel access waits for it.
+ * DMA only reads data RAM, so pixels elsewhere (const tables in program
+ * memory) are sent by the CPU before oledC_sendPixelsAsync returns.
+ * The SPI1 handler in place before the transfer is restored when it ends. */
+bool oledC_sendPixelsAsync(const uint16_t *pixels, uint16_t count);
+bool oledC_sendColorRunAsync(uint16_t color, uint16_t count);
+bool oledC_isTransferBusy(void);
+void oledC_setTransferDoneCallback(void (*callback)(void));
+
 #endif
\ No newline at end of file
@@ -0,0 +1,32 @@
+/* Generated by tools/atlasc.py, do not edit */
+
+#include <stdint.h>
+#include "oledC_atlasData.h"
+
+static const uint16_t watch_palette[16] = {
+    0xCE59,0x06E7,0xFE80,0xA300,0xE8C5,0xFFFF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+};
+static const oledC_spriteInfo_t watch_sprites[3] = {
+    {16, 8, 0},
+    {12, 12, 64},
+    {11, 10, 136},
+};
+static const uint8_t watch_pixels[196] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xFF,
+    0x0F,0x11,0xF1,0x1F,0x11,0xFF,0xF0,0x00,0x0F,0x11,0xF1,0x1F,0x11,0xFF,0xF0,0xF0,
+    0x0F,0x11,0xF1,0x1F,0x11,0xFF,0xF0,0xF0,0x0F,0x11,0xF1,0x1F,0x11,0xFF,0xF0,0x00,
+    0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
+    0xFF,0xFF,0xF2,0x2F,0xFF,0xFF,0xFF,0xFF,0x22,0x22,0xFF,0xFF,0xFF,0xF2,0x22,0x22,
+    0x2F,0xFF,0xFF,0x22,0x22,0x22,0x22,0xFF,0xFF,0x22,0x22,0x22,0x22,0xFF,0xFF,0x22,
+    0x22,0x22,0x22,0xFF,0xFF,0x22,0x22,0x22,0x22,0xFF,0xF2,0x22,0x22,0x22,0x22,0x2F,
+    0x22,0x22,0x22,0x22,0x22,0x22,0x33,0x33,0x33,0x33,0x33,0x33,0xFF,0xFF,0xF3,0x3F,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x44,0xFF,0xF4,0x4F,0xFF,0xF4,0x44,
+    0x4F,0x44,0x44,0x4F,0x44,0x54,0x44,0x44,0x44,0x4F,0x45,0x44,0x44,0x44,0x44,0x4F,
+    0x44,0x44,0x44,0x44,0x44,0x4F,0xF4,0x44,0x44,0x44,0x44,0xFF,0xFF,0x44,0x44,0x44,
+    0x4F,0xFF,0xFF,0xF4,0x44,0x44,0xFF,0xFF,0xFF,0xFF,0x44,0x4F,0xFF,0xFF,0xFF,0xFF,
+    0xF4,0xFF,0xFF,0xFF,
+};
+
+const oledC_atlas_t oledC_atlas_watch = {
+    3, 15, watch_palette, watch_sprites, watch_pixels,
+};
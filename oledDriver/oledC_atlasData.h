@@ -0,0 +1,14 @@
+/* Generated by tools/atlasc.py, do not edit */
+
+#ifndef OLEDC_ATLASDATA_H
+#define	OLEDC_ATLASDATA_H
+
+#include "oledC_sprite.h"
+
+#define OLEDC_SPRITE_WATCH_BATTERY 0
+#define OLEDC_SPRITE_WATCH_BELL 1
+#define OLEDC_SPRITE_WATCH_HEART 2
+
+extern const oledC_atlas_t oledC_atlas_watch;
+
+#endif	/* OLEDC_ATLASDATA_H */
@@ -0,0 +1,110 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oledC_band.h"
+#include "oledC_shapes.h"
+#include "oledC.h"
+
+#if OLEDC_USE_BANDS
+
+#define BAND_WIDTH 96
+#define SCREEN_HEIGHT 96
+
+static uint16_t bandBuffer[OLEDC_BAND_HEIGHT][BAND_WIDTH];
+static uint8_t bandTop = 0;
+static uint8_t bandBottom = OLEDC_BAND_HEIGHT - 1;
+
+void oledC_bandSetPixel(uint8_t x, uint8_t y, uint16_t color)
+{
+    if(x >= BAND_WIDTH || y < bandTop || y > bandBottom)
+    {
+        return;
+    }
+    bandBuffer[y - bandTop][x] = color;
+}
+
+uint16_t oledC_bandGetPixel(uint8_t x, uint8_t y)
+{
+    if(x >= BAND_WIDTH || y < bandTop || y > bandBottom)
+    {
+        return 0;
+    }
+    return bandBuffer[y - bandTop][x];
+}
+
+void oledC_bandFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    uint8_t x, y;
+    start_y = start_y < bandTop ? bandTop : start_y;
+    end_y = end_y > bandBottom ? bandBottom : end_y;
+    end_x = end_x >= BAND_WIDTH ? BAND_WIDTH - 1 : end_x;
+    if(start_x > end_x || start_y > end_y)
+    {
+        return;
+    }
+    for(y = start_y; y <= end_y; y++)
+    {
+        uint16_t *row = bandBuffer[y - bandTop];
+        for(x = start_x; x <= end_x; x++)
+        {
+            row[x] = color;
+        }
+    }
+}
+
+bool oledC_renderBands(uint16_t background, void (*drawScene)(void))
+{
+    enum OLEDC_DRAW_TARGET savedTarget = oledC_getDrawTarget();
+    uint8_t rows;
+    for(bandTop = 0; bandTop < SCREEN_HEIGHT; bandTop += OLEDC_BAND_HEIGHT)
+    {
+        bandBottom = bandTop + OLEDC_BAND_HEIGHT - 1;
+        bandBottom = bandBottom >= SCREEN_HEIGHT ? SCREEN_HEIGHT - 1 : bandBottom;
+        rows = bandBottom - bandTop + 1;
+
+        /* every band pushes at the same depth, so only the first can fail */
+        if(!oledC_pushScreenClip(0, bandTop, BAND_WIDTH, rows))
+        {
+            bandTop = 0;
+            bandBottom = OLEDC_BAND_HEIGHT - 1;
+            return false;
+        }
+        oledC_setDrawTarget(OLEDC_TARGET_BAND);
+        oledC_bandFillRect(0, bandTop, BAND_WIDTH - 1, bandBottom, background);
+        drawScene();
+        oledC_popViewport();
+        oledC_setDrawTarget(savedTarget);
+
+        oledC_setColumnAddressBounds(0, BAND_WIDTH - 1);
+        oledC_setRowAddressBounds(bandTop, bandBottom);
+        oledC_beginWriteSession();
+        oledC_sendPixels(&bandBuffer[0][0], (uint16_t)rows * BAND_WIDTH);
+        oledC_endWriteSession();
+    }
+    bandTop = 0;
+    bandBottom = OLEDC_BAND_HEIGHT - 1;
+    return true;
+}
+
+#endif
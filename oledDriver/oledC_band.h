@@ -0,0 +1,54 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef OLEDC_BAND_H
+#define	OLEDC_BAND_H
+
+#include <stdint.h>
+
+/* Band rendering needs a line buffer of 96 * 2 * OLEDC_BAND_HEIGHT bytes;
+ * it is only built when enabled */
+#ifndef OLEDC_USE_BANDS
+#define OLEDC_USE_BANDS 0
+#endif
+
+/* Rows per band: the line buffer costs 96 * 2 * OLEDC_BAND_HEIGHT bytes of RAM,
+ * and every band costs one address window */
+#ifndef OLEDC_BAND_HEIGHT
+#define OLEDC_BAND_HEIGHT 8
+#endif
+
+#if OLEDC_USE_BANDS
+void oledC_bandSetPixel(uint8_t x, uint8_t y, uint16_t color);
+uint16_t oledC_bandGetPixel(uint8_t x, uint8_t y);
+void oledC_bandFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+
+/* Renders the whole screen band by band: each band is cleared to background,
+ * drawScene() rasterizes into it and the band is streamed as one RAM write.
+ * drawScene() runs in screen coordinates under a clip of the band rows
+ * (oledC_pushScreenClip), so it can skip whatever lies outside
+ * oledC_getClip(). Returns false, before anything is sent, when the
+ * viewport stack has no room for the band clip. */
+bool oledC_renderBands(uint16_t background, void (*drawScene)(void));
+#endif
+
+#endif	/* OLEDC_BAND_H */
@@ -0,0 +1,120 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "oledC_damage.h"
+
+static oledC_damageList_t defaultList;
+
+/* a rect may span all 256 coordinates, one more than 16 bits can count */
+static uint32_t rectArea(const oledC_rect_t *rect)
+{
+    return (uint32_t)(rect->xe - rect->xs + 1) * (rect->ye - rect->ys + 1);
+}
+
+static oledC_rect_t rectUnion(const oledC_rect_t *a, const oledC_rect_t *b)
+{
+    oledC_rect_t result;
+    result.xs = a->xs < b->xs ? a->xs : b->xs;
+    result.ys = a->ys < b->ys ? a->ys : b->ys;
+    result.xe = a->xe > b->xe ? a->xe : b->xe;
+    result.ye = a->ye > b->ye ? a->ye : b->ye;
+    return result;
+}
+
+/* Merging pays off when one window over the union pushes no more than two
+ * windows over the parts, overlap included */
+static bool worthMerging(const oledC_rect_t *a, const oledC_rect_t *b)
+{
+    oledC_rect_t merged = rectUnion(a, b);
+    return rectArea(&merged) <= rectArea(a) + rectArea(b) + OLEDC_DAMAGE_WINDOW_COST;
+}
+
+void oledC_damageListAdd(oledC_damageList_t *list, uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y)
+{
+    oledC_rect_t rect;
+    uint8_t i;
+    uint8_t best = 0;
+    uint32_t bestGrowth = 0xFFFFFFFFUL;
+    if(end_x < start_x || end_y < start_y)
+    {
+        return;
+    }
+    rect.xs = start_x;
+    rect.ys = start_y;
+    rect.xe = end_x;
+    rect.ye = end_y;
+
+    /* absorb every rect it pays to merge with, restarting as the union grows */
+    i = 0;
+    while(i < list->count)
+    {
+        if(worthMerging(&rect, &list->rects[i]))
+        {
+            rect = rectUnion(&rect, &list->rects[i]);
+            list->rects[i] = list->rects[--list->count];
+            i = 0;
+            continue;
+        }
+        i++;
+    }
+    if(list->count < OLEDC_DAMAGE_MAX_RECTS)
+    {
+        list->rects[list->count++] = rect;
+        return;
+    }
+
+    /* list full: fold into the rect that grows the least */
+    for(i = 0; i < list->count; i++)
+    {
+        oledC_rect_t merged = rectUnion(&rect, &list->rects[i]);
+        uint32_t growth = rectArea(&merged) - rectArea(&list->rects[i]);
+        if(growth < bestGrowth)
+        {
+            bestGrowth = growth;
+            best = i;
+        }
+    }
+    list->rects[best] = rectUnion(&rect, &list->rects[best]);
+}
+
+void oledC_damageAdd(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y)
+{
+    oledC_damageListAdd(&defaultList, start_x, start_y, end_x, end_y);
+}
+
+uint8_t oledC_damageCount(void)
+{
+    return defaultList.count;
+}
+
+const oledC_rect_t* oledC_damageGet(uint8_t index)
+{
+    return index < defaultList.count ? &defaultList.rects[index] : NULL;
+}
+
+void oledC_damageClear(void)
+{
+    defaultList.count = 0;
+}
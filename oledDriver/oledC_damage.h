@@ -0,0 +1,60 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef OLEDC_DAMAGE_H
+#define	OLEDC_DAMAGE_H
+
+#include <stdint.h>
+
+#ifndef OLEDC_DAMAGE_MAX_RECTS
+#define OLEDC_DAMAGE_MAX_RECTS 8
+#endif
+
+/* Cost of opening an address window (column + row + WRITE_RAM commands and
+ * their chip-select cycles) expressed in pixels pushed */
+#ifndef OLEDC_DAMAGE_WINDOW_COST
+#define OLEDC_DAMAGE_WINDOW_COST 16
+#endif
+
+typedef struct oledC_rect_t
+{
+    uint8_t xs;
+    uint8_t ys;
+    uint8_t xe;
+    uint8_t ye;
+} oledC_rect_t;
+
+typedef struct oledC_damageList_t
+{
+    oledC_rect_t rects[OLEDC_DAMAGE_MAX_RECTS];
+    uint8_t count;
+} oledC_damageList_t;
+
+void oledC_damageListAdd(oledC_damageList_t *list, uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y);
+
+/* The default list, flushed by the framebuffer */
+void oledC_damageAdd(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y);
+uint8_t oledC_damageCount(void);
+const oledC_rect_t* oledC_damageGet(uint8_t index);
+void oledC_damageClear(void);
+
+#endif	/* OLEDC_DAMAGE_H */
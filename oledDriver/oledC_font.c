@@ -0,0 +1,138 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oledC_font.h"
+#include "oledC_shapes.h"
+#include "oledC.h"
+
+#define SCREEN_HEIGHT 96
+
+static bool glyphIndex(const oledC_font_t *font, uint8_t ch, uint8_t *index)
+{
+    if(ch < font->first || ch - font->first >= font->count || font->widths[ch - font->first] == 0)
+    {
+        return false;
+    }
+    *index = ch - font->first;
+    return true;
+}
+
+uint8_t oledC_fontGlyphWidth(const oledC_font_t *font, uint8_t ch)
+{
+    uint8_t index;
+    return glyphIndex(font, ch, &index) ? font->widths[index] : 0;
+}
+
+uint8_t oledC_fontTextWidth(const oledC_font_t *font, const char *text)
+{
+    uint16_t width = 0;
+    while(*text)
+    {
+        width += oledC_fontGlyphWidth(font, *text++) + font->spacing;
+    }
+    return width > 0xFF ? 0xFF : width;
+}
+
+static bool columnBit(const uint8_t *column, uint8_t row)
+{
+    return column[row >> 3] & (1 << (row & 0x07));
+}
+
+/* Expects vertical increment mode on the panel target */
+static uint8_t drawGlyphCell(uint8_t x, uint8_t y, const oledC_font_t *font, uint8_t ch, uint16_t fg, uint16_t bg)
+{
+    static uint16_t columnPixels[SCREEN_HEIGHT];
+    const uint8_t *column;
+    uint8_t index, glyphWidth, advance, width, height, bytesPerColumn, cx, row, run, screenX, screenY;
+    bool lit;
+
+    if(!glyphIndex(font, ch, &index))
+    {
+        return 0;
+    }
+    glyphWidth = font->widths[index];
+    advance = glyphWidth + font->spacing;
+    width = advance > 0xFF - x ? 0xFF - x : advance;
+    height = font->height > 0xFF - y ? 0xFF - y : font->height;
+    bytesPerColumn = (font->height + 7) >> 3;
+    column = &font->bitmap[font->offsets[index]];
+
+    if(oledC_getDrawTarget() != OLEDC_TARGET_PANEL || !oledC_viewportWindow(x, y, width, height, &screenX, &screenY))
+    {
+        /* off-screen targets and clipped cells: one rectangle per vertical
+         * run, clipped by oledC_DrawRectangle */
+        for(cx = 0; cx < width; cx++, column += bytesPerColumn)
+        {
+            for(row = 0; row < height; row += run)
+            {
+                lit = cx < glyphWidth && columnBit(column, row);
+                for(run = 1; row + run < height && (cx < glyphWidth && columnBit(column, row + run)) == lit; run++);
+                oledC_DrawRectangle(x + cx, y + row, x + cx, y + row + run - 1, lit ? fg : bg);
+            }
+        }
+        return advance;
+    }
+
+    /* panel: one window per cell, the packed columns stream as they are */
+    oledC_setColumnAddressBounds(screenX, screenX + width - 1);
+    oledC_setRowAddressBounds(screenY, screenY + height - 1);
+    oledC_beginWriteSession();
+    for(cx = 0; cx < width; cx++, column += bytesPerColumn)
+    {
+        if(cx >= glyphWidth)
+        {
+            oledC_sendColorRun(bg, (uint16_t)(width - cx) * height);
+            break;
+        }
+        for(row = 0; row < height; row++)
+        {
+            columnPixels[row] = columnBit(column, row) ? fg : bg;
+        }
+        oledC_sendPixels(columnPixels, height);
+    }
+    oledC_endWriteSession();
+    return advance;
+}
+
+uint8_t oledC_DrawGlyph(uint8_t x, uint8_t y, const oledC_font_t *font, uint8_t ch, uint16_t fg, uint16_t bg)
+{
+    uint8_t advance;
+    oledC_setVerticalIncrement(oledC_getDrawTarget() == OLEDC_TARGET_PANEL);
+    advance = drawGlyphCell(x, y, font, ch, fg, bg);
+    oledC_setVerticalIncrement(false);
+    return advance;
+}
+
+uint8_t oledC_DrawText(uint8_t x, uint8_t y, const oledC_font_t *font, const char *text, uint16_t fg, uint16_t bg)
+{
+    uint16_t position = x;
+    /* the remap is switched once for the whole string */
+    oledC_setVerticalIncrement(oledC_getDrawTarget() == OLEDC_TARGET_PANEL);
+    while(*text && position < 0xFF)
+    {
+        position += drawGlyphCell(position, y, font, *text++, fg, bg);
+    }
+    oledC_setVerticalIncrement(false);
+    return position > 0xFF ? 0xFF : position;
+}
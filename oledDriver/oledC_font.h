@@ -0,0 +1,50 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef OLEDC_FONT_H
+#define	OLEDC_FONT_H
+
+#include <stdint.h>
+
+/* Packed font built by tools/fontc.py. Glyphs are column-major with
+ * (height + 7) / 8 bytes per column, bit 0 of the first byte at the top;
+ * offsets[] gives every glyph's start in bitmap[] for O(1) lookup. */
+typedef struct
+{
+    uint8_t height;
+    uint8_t first;
+    uint8_t count;
+    uint8_t spacing;    /* blank columns after every glyph */
+    const uint8_t *widths;
+    const uint16_t *offsets;
+    const uint8_t *bitmap;
+} oledC_font_t;
+
+uint8_t oledC_fontGlyphWidth(const oledC_font_t *font, uint8_t ch);
+uint8_t oledC_fontTextWidth(const oledC_font_t *font, const char *text);
+
+/* Opaque glyph cell, spacing included; returns the advance in pixels */
+uint8_t oledC_DrawGlyph(uint8_t x, uint8_t y, const oledC_font_t *font, uint8_t ch, uint16_t fg, uint16_t bg);
+/* Returns the x position after the last glyph */
+uint8_t oledC_DrawText(uint8_t x, uint8_t y, const oledC_font_t *font, const char *text, uint16_t fg, uint16_t bg);
+
+#endif	/* OLEDC_FONT_H */
@@ -0,0 +1,131 @@
+/* Generated by tools/fontc.py from fonts.txt, do not edit */
+
+#include <stdint.h>
+#include "oledC_fontData.h"
+
+static const uint8_t small_widths[95] = {
+    0x03,0x01,0x03,0x05,0x05,0x05,0x05,0x03,0x03,0x03,0x05,0x05,0x02,0x05,0x02,0x05,
+    0x05,0x03,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x01,0x02,0x04,0x05,0x04,0x05,
+    0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x03,0x05,0x05,0x05,0x05,0x05,0x05,
+    0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x05,0x04,0x05,0x05,
+    0x03,0x05,0x05,0x05,0x05,0x05,0x04,0x05,0x05,0x03,0x04,0x04,0x03,0x05,0x05,0x05,
+    0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x03,0x01,0x03,0x05,
+};
+static const uint16_t small_offsets[95] = {
+    0,3,4,7,12,17,22,27,30,33,36,41,
+    46,48,53,55,60,65,68,73,78,83,88,93,
+    98,103,108,109,111,115,120,124,129,134,139,144,
+    149,154,159,164,169,174,177,182,187,192,197,202,
+    207,212,217,222,227,232,237,242,247,252,257,262,
+    266,271,275,280,285,288,293,298,303,308,313,317,
+    322,327,330,334,338,341,346,351,356,361,366,371,
+    376,381,386,391,396,401,406,411,414,415,418,
+};
+static const uint8_t small_bitmap[423] = {
+    0x00,0x00,0x00,0x5F,0x07,0x00,0x07,0x14,0x7F,0x14,0x7F,0x14,0x24,0x2A,0x7F,0x2A,
+    0x12,0x23,0x13,0x08,0x64,0x62,0x36,0x49,0x56,0x20,0x50,0x08,0x07,0x03,0x1C,0x22,
+    0x41,0x41,0x22,0x1C,0x2A,0x1C,0x7F,0x1C,0x2A,0x08,0x08,0x3E,0x08,0x08,0x70,0x30,
+    0x08,0x08,0x08,0x08,0x08,0x60,0x60,0x20,0x10,0x08,0x04,0x02,0x3E,0x51,0x49,0x45,
+    0x3E,0x42,0x7F,0x40,0x72,0x49,0x49,0x49,0x46,0x21,0x41,0x49,0x4D,0x33,0x18,0x14,
+    0x12,0x7F,0x10,0x27,0x45,0x45,0x45,0x39,0x3C,0x4A,0x49,0x49,0x31,0x41,0x21,0x11,
+    0x09,0x07,0x36,0x49,0x49,0x49,0x36,0x46,0x49,0x49,0x29,0x1E,0x14,0x40,0x34,0x08,
+    0x14,0x22,0x41,0x14,0x14,0x14,0x14,0x14,0x41,0x22,0x14,0x08,0x02,0x01,0x59,0x09,
+    0x06,0x3E,0x41,0x5D,0x59,0x4E,0x7C,0x12,0x11,0x12,0x7C,0x7F,0x49,0x49,0x49,0x36,
+    0x3E,0x41,0x41,0x41,0x22,0x7F,0x41,0x41,0x41,0x3E,0x7F,0x49,0x49,0x49,0x41,0x7F,
+    0x09,0x09,0x09,0x01,0x3E,0x41,0x41,0x51,0x73,0x7F,0x08,0x08,0x08,0x7F,0x41,0x7F,
+    0x41,0x20,0x40,0x41,0x3F,0x01,0x7F,0x08,0x14,0x22,0x41,0x7F,0x40,0x40,0x40,0x40,
+    0x7F,0x02,0x1C,0x02,0x7F,0x7F,0x04,0x08,0x10,0x7F,0x3E,0x41,0x41,0x41,0x3E,0x7F,
+    0x09,0x09,0x09,0x06,0x3E,0x41,0x51,0x21,0x5E,0x7F,0x09,0x19,0x29,0x46,0x26,0x49,
+    0x49,0x49,0x32,0x03,0x01,0x7F,0x01,0x03,0x3F,0x40,0x40,0x40,0x3F,0x1F,0x20,0x40,
+    0x20,0x1F,0x3F,0x40,0x38,0x40,0x3F,0x63,0x14,0x08,0x14,0x63,0x03,0x04,0x78,0x04,
+    0x03,0x61,0x59,0x49,0x4D,0x43,0x7F,0x41,0x41,0x41,0x02,0x04,0x08,0x10,0x20,0x41,
+    0x41,0x41,0x7F,0x04,0x02,0x01,0x02,0x04,0x40,0x40,0x40,0x40,0x40,0x03,0x07,0x08,
+    0x20,0x54,0x54,0x38,0x40,0x7F,0x28,0x44,0x44,0x38,0x38,0x44,0x44,0x44,0x28,0x38,
+    0x44,0x44,0x28,0x7F,0x38,0x54,0x54,0x54,0x18,0x08,0x7E,0x09,0x02,0x0C,0x52,0x52,
+    0x4A,0x3C,0x7F,0x08,0x04,0x04,0x78,0x44,0x7D,0x40,0x20,0x40,0x40,0x3D,0x7F,0x10,
+    0x28,0x44,0x41,0x7F,0x40,0x7C,0x04,0x78,0x04,0x78,0x7C,0x08,0x04,0x04,0x78,0x38,
+    0x44,0x44,0x44,0x38,0x7C,0x18,0x24,0x24,0x18,0x18,0x24,0x24,0x18,0x7C,0x7C,0x08,
+    0x04,0x04,0x08,0x48,0x54,0x54,0x54,0x24,0x04,0x04,0x3F,0x44,0x24,0x3C,0x40,0x40,
+    0x20,0x7C,0x1C,0x20,0x40,0x20,0x1C,0x3C,0x40,0x30,0x40,0x3C,0x44,0x28,0x10,0x28,
+    0x44,0x4C,0x50,0x50,0x50,0x3C,0x44,0x64,0x54,0x4C,0x44,0x08,0x36,0x41,0x7F,0x41,
+    0x36,0x08,0x02,0x01,0x02,0x04,0x02,
+};
+
+const oledC_font_t oledC_font_small = {
+    8, 0x20, 95, 1,
+    small_widths, small_offsets, small_bitmap,
+};
+
+static const uint8_t digits2x_widths[12] = {
+    0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,
+};
+static const uint16_t digits2x_offsets[12] = {
+    0,20,40,60,80,100,120,140,160,180,200,220,
+};
+static const uint8_t digits2x_bitmap[240] = {
+    0x00,0x0C,0x00,0x0C,0x00,0x03,0x00,0x03,0xC0,0x00,0xC0,0x00,0x30,0x00,0x30,0x00,
+    0x0C,0x00,0x0C,0x00,0xFC,0x0F,0xFC,0x0F,0x03,0x33,0x03,0x33,0xC3,0x30,0xC3,0x30,
+    0x33,0x30,0x33,0x30,0xFC,0x0F,0xFC,0x0F,0x00,0x00,0x00,0x00,0x0C,0x30,0x0C,0x30,
+    0xFF,0x3F,0xFF,0x3F,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x00,0x0C,0x3F,0x0C,0x3F,
+    0xC3,0x30,0xC3,0x30,0xC3,0x30,0xC3,0x30,0xC3,0x30,0xC3,0x30,0x3C,0x30,0x3C,0x30,
+    0x03,0x0C,0x03,0x0C,0x03,0x30,0x03,0x30,0xC3,0x30,0xC3,0x30,0xF3,0x30,0xF3,0x30,
+    0x0F,0x0F,0x0F,0x0F,0xC0,0x03,0xC0,0x03,0x30,0x03,0x30,0x03,0x0C,0x03,0x0C,0x03,
+    0xFF,0x3F,0xFF,0x3F,0x00,0x03,0x00,0x03,0x3F,0x0C,0x3F,0x0C,0x33,0x30,0x33,0x30,
+    0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0xC3,0x0F,0xC3,0x0F,0xF0,0x0F,0xF0,0x0F,
+    0xCC,0x30,0xCC,0x30,0xC3,0x30,0xC3,0x30,0xC3,0x30,0xC3,0x30,0x03,0x0F,0x03,0x0F,
+    0x03,0x30,0x03,0x30,0x03,0x0C,0x03,0x0C,0x03,0x03,0x03,0x03,0xC3,0x00,0xC3,0x00,
+    0x3F,0x00,0x3F,0x00,0x3C,0x0F,0x3C,0x0F,0xC3,0x30,0xC3,0x30,0xC3,0x30,0xC3,0x30,
+    0xC3,0x30,0xC3,0x30,0x3C,0x0F,0x3C,0x0F,0x3C,0x30,0x3C,0x30,0xC3,0x30,0xC3,0x30,
+    0xC3,0x30,0xC3,0x30,0xC3,0x0C,0xC3,0x0C,0xFC,0x03,0xFC,0x03,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x30,0x03,0x30,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const oledC_font_t oledC_font_digits2x = {
+    16, 0x2F, 12, 2,
+    digits2x_widths, digits2x_offsets, digits2x_bitmap,
+};
+
+static const uint8_t digits3x_widths[11] = {
+    0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,
+};
+static const uint16_t digits3x_offsets[11] = {
+    0,45,90,135,180,225,270,315,360,405,450,
+};
+static const uint8_t digits3x_bitmap[495] = {
+    0xF8,0xFF,0x03,0xF8,0xFF,0x03,0xF8,0xFF,0x03,0x07,0x70,0x1C,0x07,0x70,0x1C,0x07,
+    0x70,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0xC7,0x01,0x1C,0xC7,0x01,
+    0x1C,0xC7,0x01,0x1C,0xF8,0xFF,0x03,0xF8,0xFF,0x03,0xF8,0xFF,0x03,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x1C,0x38,0x00,0x1C,0x38,0x00,0x1C,0xFF,
+    0xFF,0x1F,0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
+    0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xF0,0x1F,0x38,0xF0,0x1F,
+    0x38,0xF0,0x1F,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,
+    0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0xF8,0x01,
+    0x1C,0xF8,0x01,0x1C,0xF8,0x01,0x1C,0x07,0x80,0x03,0x07,0x80,0x03,0x07,0x80,0x03,
+    0x07,0x00,0x1C,0x07,0x00,0x1C,0x07,0x00,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,
+    0x0E,0x1C,0xC7,0x0F,0x1C,0xC7,0x0F,0x1C,0xC7,0x0F,0x1C,0x3F,0xF0,0x03,0x3F,0xF0,
+    0x03,0x3F,0xF0,0x03,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0xC0,0x71,0x00,
+    0xC0,0x71,0x00,0xC0,0x71,0x00,0x38,0x70,0x00,0x38,0x70,0x00,0x38,0x70,0x00,0xFF,
+    0xFF,0x1F,0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,
+    0x00,0xFF,0x81,0x03,0xFF,0x81,0x03,0xFF,0x81,0x03,0xC7,0x01,0x1C,0xC7,0x01,0x1C,
+    0xC7,0x01,0x1C,0xC7,0x01,0x1C,0xC7,0x01,0x1C,0xC7,0x01,0x1C,0xC7,0x01,0x1C,0xC7,
+    0x01,0x1C,0xC7,0x01,0x1C,0x07,0xFE,0x03,0x07,0xFE,0x03,0x07,0xFE,0x03,0xC0,0xFF,
+    0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x38,0x0E,0x1C,0x38,0x0E,0x1C,0x38,0x0E,0x1C,
+    0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,
+    0x0E,0x1C,0x07,0xF0,0x03,0x07,0xF0,0x03,0x07,0xF0,0x03,0x07,0x00,0x1C,0x07,0x00,
+    0x1C,0x07,0x00,0x1C,0x07,0x80,0x03,0x07,0x80,0x03,0x07,0x80,0x03,0x07,0x70,0x00,
+    0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x0E,0x00,0x07,0x0E,0x00,0x07,0x0E,0x00,0xFF,
+    0x01,0x00,0xFF,0x01,0x00,0xFF,0x01,0x00,0xF8,0xF1,0x03,0xF8,0xF1,0x03,0xF8,0xF1,
+    0x03,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,
+    0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0xF8,0xF1,0x03,0xF8,
+    0xF1,0x03,0xF8,0xF1,0x03,0xF8,0x01,0x1C,0xF8,0x01,0x1C,0xF8,0x01,0x1C,0x07,0x0E,
+    0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,0x07,0x0E,0x1C,
+    0x07,0x8E,0x03,0x07,0x8E,0x03,0x07,0x8E,0x03,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,
+    0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xC0,0x71,0x00,0xC0,0x71,0x00,0xC0,0x71,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const oledC_font_t oledC_font_digits3x = {
+    24, 0x30, 11, 3,
+    digits3x_widths, digits3x_offsets, digits3x_bitmap,
+};
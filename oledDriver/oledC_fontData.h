@@ -0,0 +1,12 @@
+/* Generated by tools/fontc.py from fonts.txt, do not edit */
+
+#ifndef OLEDC_FONTDATA_H
+#define	OLEDC_FONTDATA_H
+
+#include "oledC_font.h"
+
+extern const oledC_font_t oledC_font_small;
+extern const oledC_font_t oledC_font_digits2x;
+extern const oledC_font_t oledC_font_digits3x;
+
+#endif	/* OLEDC_FONTDATA_H */
@@ -0,0 +1,234 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oledC_framebuffer.h"
+#include "oledC_damage.h"
+#include "oledC.h"
+
+#if OLEDC_USE_FRAMEBUFFER
+
+#if OLEDC_FB_BITS_PER_PIXEL == 4
+#define FB_ROW_BYTES (OLEDC_FB_WIDTH / 2)
+#elif OLEDC_FB_BITS_PER_PIXEL == 8
+#define FB_ROW_BYTES OLEDC_FB_WIDTH
+#else
+#error "OLEDC_FB_BITS_PER_PIXEL must be 4 or 8"
+#endif
+
+static uint8_t frameBuffer[OLEDC_FB_HEIGHT][FB_ROW_BYTES];
+/* entry 0 is black, the colour of a zero-initialized buffer */
+static uint16_t palette[OLEDC_FB_PALETTE_SIZE] = { 0x0000 };
+static uint16_t paletteUsed = 1;
+/* pixels using each entry; an entry no pixel uses is free for a new colour */
+static uint16_t paletteRefs[OLEDC_FB_PALETTE_SIZE] = { OLEDC_FB_WIDTH * OLEDC_FB_HEIGHT };
+
+static uint8_t readIndex(uint8_t x, uint8_t y);
+static void writeIndex(uint8_t x, uint8_t y, uint8_t index);
+
+static uint8_t readIndex(uint8_t x, uint8_t y)
+{
+#if OLEDC_FB_BITS_PER_PIXEL == 4
+    uint8_t packed = frameBuffer[y][x >> 1];
+    return (x & 0x01) ? (packed & 0x0F) : (packed >> 4);
+#else
+    return frameBuffer[y][x];
+#endif
+}
+
+static void writeIndex(uint8_t x, uint8_t y, uint8_t index)
+{
+    paletteRefs[readIndex(x, y)]--;
+    paletteRefs[index]++;
+#if OLEDC_FB_BITS_PER_PIXEL == 4
+    uint8_t *packed = &frameBuffer[y][x >> 1];
+    *packed = (x & 0x01) ? ((*packed & 0xF0) | index) : ((*packed & 0x0F) | (index << 4));
+#else
+    frameBuffer[y][x] = index;
+#endif
+}
+
+/* Exact match, then an entry no pixel uses any more, then a new entry; once
+ * all are in use the closest colour */
+uint8_t oledC_fbColorIndex(uint16_t color)
+{
+    uint16_t i, free = OLEDC_FB_PALETTE_SIZE;
+    for(i = 0; i < paletteUsed; i++)
+    {
+        if(palette[i] == color)
+        {
+            return i;
+        }
+        if(!paletteRefs[i] && free == OLEDC_FB_PALETTE_SIZE)
+        {
+            free = i;
+        }
+    }
+    if(free == OLEDC_FB_PALETTE_SIZE && paletteUsed < OLEDC_FB_PALETTE_SIZE)
+    {
+        free = paletteUsed++;
+    }
+    if(free < OLEDC_FB_PALETTE_SIZE)
+    {
+        palette[free] = color;
+        return free;
+    }
+    /* palette full: fall back to the closest entry */
+    return oledC_closestColor(palette, paletteUsed, color);
+}
+
+uint16_t oledC_fbColorsInUse(void)
+{
+    uint16_t i, count = 0;
+    for(i = 0; i < paletteUsed; i++)
+    {
+        count += paletteRefs[i] ? 1 : 0;
+    }
+    return count;
+}
+
+void oledC_fbSetPalette(uint8_t index, uint16_t color)
+{
+    if(index >= OLEDC_FB_PALETTE_SIZE)
+    {
+        return;
+    }
+    palette[index] = color;
+    paletteUsed = index >= paletteUsed ? index + 1 : paletteUsed;
+    /* pixels already using this entry change colour on the panel too */
+    oledC_damageAdd(0, 0, OLEDC_FB_WIDTH - 1, OLEDC_FB_HEIGHT - 1);
+}
+
+uint16_t oledC_fbPaletteColor(uint8_t index)
+{
+    return index < OLEDC_FB_PALETTE_SIZE ? palette[index] : 0;
+}
+
+void oledC_fbClear(uint16_t color)
+{
+    oledC_fbFillRect(0, 0, OLEDC_FB_WIDTH - 1, OLEDC_FB_HEIGHT - 1, color);
+}
+
+void oledC_fbSetPixel(uint8_t x, uint8_t y, uint16_t color)
+{
+    uint8_t index;
+    if(x >= OLEDC_FB_WIDTH || y >= OLEDC_FB_HEIGHT)
+    {
+        return;
+    }
+    index = oledC_fbColorIndex(color);
+    if(readIndex(x, y) != index)
+    {
+        writeIndex(x, y, index);
+        oledC_damageAdd(x, y, x, y);
+    }
+}
+
+uint16_t oledC_fbGetPixel(uint8_t x, uint8_t y)
+{
+    if(x >= OLEDC_FB_WIDTH || y >= OLEDC_FB_HEIGHT)
+    {
+        return 0;
+    }
+    return palette[readIndex(x, y)];
+}
+
+void oledC_fbFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    uint8_t index;
+    uint8_t x, y;
+    bool changed = false;
+    oledC_rect_t bounds = { OLEDC_FB_WIDTH, OLEDC_FB_HEIGHT, 0, 0 };
+    end_x = end_x >= OLEDC_FB_WIDTH ? OLEDC_FB_WIDTH - 1 : end_x;
+    end_y = end_y >= OLEDC_FB_HEIGHT ? OLEDC_FB_HEIGHT - 1 : end_y;
+    if(start_x > end_x || start_y > end_y)
+    {
+        return;
+    }
+    index = oledC_fbColorIndex(color);
+    for(y = start_y; y <= end_y; y++)
+    {
+        for(x = start_x; x <= end_x; x++)
+        {
+            if(readIndex(x, y) != index)
+            {
+                writeIndex(x, y, index);
+                bounds.xs = x < bounds.xs ? x : bounds.xs;
+                bounds.xe = x > bounds.xe ? x : bounds.xe;
+                bounds.ys = y < bounds.ys ? y : bounds.ys;
+                bounds.ye = y;
+                changed = true;
+            }
+        }
+    }
+    /* damage covers only the pixels that really changed */
+    if(changed)
+    {
+        oledC_damageAdd(bounds.xs, bounds.ys, bounds.xe, bounds.ye);
+    }
+}
+
+bool oledC_fbIsDirty(void)
+{
+    return oledC_damageCount() > 0;
+}
+
+/* Streams one window of palette indices as RGB565 runs */
+static void flushWindow(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y)
+{
+    uint8_t x, y;
+    oledC_setColumnAddressBounds(start_x, end_x);
+    oledC_setRowAddressBounds(start_y, end_y);
+    oledC_beginWriteSession();
+    for(y = start_y; y <= end_y; y++)
+    {
+        uint8_t runIndex = readIndex(start_x, y);
+        uint16_t runLength = 0;
+        for(x = start_x; x <= end_x; x++)
+        {
+            uint8_t index = readIndex(x, y);
+            if(index != runIndex)
+            {
+                oledC_sendColorRun(palette[runIndex], runLength);
+                runIndex = index;
+                runLength = 0;
+            }
+            runLength++;
+        }
+        oledC_sendColorRun(palette[runIndex], runLength);
+    }
+    oledC_endWriteSession();
+}
+
+void oledC_fbFlush(void)
+{
+    uint8_t i;
+    for(i = 0; i < oledC_damageCount(); i++)
+    {
+        const oledC_rect_t *rect = oledC_damageGet(i);
+        flushWindow(rect->xs, rect->ys, rect->xe, rect->ye);
+    }
+    oledC_damageClear();
+}
+
+#endif
@@ -0,0 +1,63 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef OLEDC_FRAMEBUFFER_H
+#define	OLEDC_FRAMEBUFFER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Palettized shadow of the panel: 4 bpp (4.6 KB) or 8 bpp (9 KB) of RAM,
+ * only built when enabled */
+#ifndef OLEDC_USE_FRAMEBUFFER
+#define OLEDC_USE_FRAMEBUFFER 1
+#endif
+
+#ifndef OLEDC_FB_BITS_PER_PIXEL
+#define OLEDC_FB_BITS_PER_PIXEL 4
+#endif
+
+#define OLEDC_FB_WIDTH 96
+#define OLEDC_FB_HEIGHT 96
+#define OLEDC_FB_PALETTE_SIZE (1 << OLEDC_FB_BITS_PER_PIXEL)
+
+#if OLEDC_USE_FRAMEBUFFER
+void oledC_fbClear(uint16_t color);
+void oledC_fbSetPixel(uint8_t x, uint8_t y, uint16_t color);
+uint16_t oledC_fbGetPixel(uint8_t x, uint8_t y);
+void oledC_fbFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+
+/* Palette entries are counted by the pixels that use them. An entry whose
+ * last pixel is overwritten is taken by the next new colour, so the 16 (or
+ * 256) entries limit the colours on screen at once, not the colours ever
+ * drawn. oledC_fbColorIndex() may hand out such an entry until a pixel
+ * takes it. */
+uint8_t oledC_fbColorIndex(uint16_t color);
+uint16_t oledC_fbColorsInUse(void);
+void oledC_fbSetPalette(uint8_t index, uint16_t color);
+uint16_t oledC_fbPaletteColor(uint8_t index);
+
+bool oledC_fbIsDirty(void);
+void oledC_fbFlush(void);
+#endif
+
+#endif	/* OLEDC_FRAMEBUFFER_H */
@@ -0,0 +1,148 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oledC_image.h"
+#include "oledC_shapes.h"
+#include "oledC_damage.h"
+#include "oledC.h"
+
+/* Reads the run at *pos and moves past it */
+static uint16_t nextRun(const oledC_image_t *image, uint16_t *pos, uint8_t *index)
+{
+    uint8_t code = image->data[(*pos)++];
+    uint16_t length = (code & 0x0F) + 1;
+    *index = code >> 4;
+    if((code & 0x0F) == OLEDC_IMAGE_LONG_RUN && *pos < image->length)
+    {
+        length = 16 + image->data[(*pos)++];
+    }
+    return length;
+}
+
+/* Splits a run into row pieces and draws the visible part of each */
+static void drawClippedRun(uint8_t x, uint8_t y, const oledC_image_t *image, uint16_t start, uint16_t length, uint16_t color)
+{
+    while(length > 0)
+    {
+        uint8_t row = start / image->width;
+        uint8_t col = start % image->width;
+        uint16_t piece = image->width - col;
+        uint16_t left = x + col, right, top = y + row;
+        piece = piece > length ? length : piece;
+        right = left + piece - 1;
+        if(top <= 0xFF && left <= 0xFF)
+        {
+            right = right > 0xFF ? 0xFF : right;
+            oledC_DrawRectangle(left, top, right, top, color);
+        }
+        start += piece;
+        length -= piece;
+    }
+}
+
+/* Streams the pieces of a run that fall inside the visible columns and
+ * rows [c0, c1] x [r0, r1] of the image, in the order the window takes them */
+static void streamVisibleRun(const oledC_image_t *image, const oledC_rect_t *visible, uint16_t start, uint16_t length, uint16_t color)
+{
+    while(length > 0)
+    {
+        uint8_t row = start / image->width;
+        uint8_t col = start % image->width;
+        uint16_t piece = image->width - col;
+        uint8_t left = col, right;
+        piece = piece > length ? length : piece;
+        right = col + piece - 1;
+        left = left < visible->xs ? visible->xs : left;
+        right = right > visible->xe ? visible->xe : right;
+        if(row >= visible->ys && row <= visible->ye && left <= right)
+        {
+            oledC_sendColorRun(color, right - left + 1);
+        }
+        start += piece;
+        length -= piece;
+    }
+}
+
+void oledC_DrawImage(uint8_t x, uint8_t y, const oledC_image_t *image)
+{
+    uint16_t pos = 0, pixel = 0, total, length;
+    uint8_t index, screenX, screenY;
+    int16_t clipXs, clipYs, clipXe, clipYe;
+    oledC_rect_t visible;
+    bool streamed, whole;
+
+    if(image->width == 0 || image->height == 0)
+    {
+        return;
+    }
+    /* the part of the image inside the clip rectangle, in image coordinates */
+    oledC_getClip(&clipXs, &clipYs, &clipXe, &clipYe);
+    clipXs -= x;
+    clipYs -= y;
+    clipXe -= x;
+    clipYe -= y;
+    if(clipXe < 0 || clipYe < 0 || clipXs >= image->width || clipYs >= image->height || clipXs > clipXe || clipYs > clipYe)
+    {
+        return;
+    }
+    visible.xs = clipXs < 0 ? 0 : clipXs;
+    visible.ys = clipYs < 0 ? 0 : clipYs;
+    visible.xe = clipXe >= image->width ? image->width - 1 : clipXe;
+    visible.ye = clipYe >= image->height ? image->height - 1 : clipYe;
+    whole = visible.xs == 0 && visible.ys == 0 && visible.xe == image->width - 1 && visible.ye == image->height - 1;
+
+    /* on the panel the visible part is one window, even when clipped */
+    total = (uint16_t)image->width * image->height;
+    streamed = oledC_getDrawTarget() == OLEDC_TARGET_PANEL &&
+        oledC_viewportWindow((int16_t)x + visible.xs, (int16_t)y + visible.ys,
+            visible.xe - visible.xs + 1, visible.ye - visible.ys + 1, &screenX, &screenY);
+    if(streamed)
+    {
+        oledC_setColumnAddressBounds(screenX, screenX + visible.xe - visible.xs);
+        oledC_setRowAddressBounds(screenY, screenY + visible.ye - visible.ys);
+        oledC_beginWriteSession();
+    }
+    while(pos < image->length && pixel < total)
+    {
+        length = nextRun(image, &pos, &index);
+        length = length > total - pixel ? total - pixel : length;
+        if(streamed && whole)
+        {
+            oledC_sendColorRun(image->palette[index], length);
+        }
+        else if(streamed)
+        {
+            streamVisibleRun(image, &visible, pixel, length, image->palette[index]);
+        }
+        else
+        {
+            drawClippedRun(x, y, image, pixel, length, image->palette[index]);
+        }
+        pixel += length;
+    }
+    if(streamed)
+    {
+        oledC_endWriteSession();
+    }
+}
@@ -0,0 +1,48 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef OLEDC_IMAGE_H
+#define	OLEDC_IMAGE_H
+
+#include <stdint.h>
+
+/* Palette RLE image built by tools/imgc.py. Runs go in raster order and
+ * may wrap from one row into the next. Every run starts with a byte
+ * holding the palette index in bits 7..4 and the length - 1 in bits 3..0.
+ * A length field of 15 means the next byte holds length - 16 (16..271). */
+typedef struct
+{
+    uint8_t width;
+    uint8_t height;
+    const uint16_t *palette;
+    const uint8_t *data;
+    uint16_t length;    /* bytes in data */
+} oledC_image_t;
+
+#define OLEDC_IMAGE_LONG_RUN 0x0F
+
+/* Streams the image into one address window without an intermediate
+ * buffer. On the panel a clipped image streams only its visible part;
+ * other targets get the visible row pieces of every run */
+void oledC_DrawImage(uint8_t x, uint8_t y, const oledC_image_t *image);
+
+#endif	/* OLEDC_IMAGE_H */
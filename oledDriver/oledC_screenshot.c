@@ -0,0 +1,62 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <stdint.h>
+#include "oledC_screenshot.h"
+#include "oledC.h"
+
+#define SCREEN_WIDTH 96
+#define SCREEN_HEIGHT 96
+
+static uint16_t rowBuffer[SCREEN_WIDTH];
+
+static void emitRun(void (*emit)(const uint8_t *data, uint8_t length), uint16_t color, uint8_t length)
+{
+    uint8_t run[3];
+    run[0] = length - 1;
+    run[1] = color >> 8;
+    run[2] = color & 0xFF;
+    emit(run, 3);
+}
+
+void oledC_screenshot(void (*emit)(const uint8_t *data, uint8_t length))
+{
+    uint8_t header[6] = {'O', 'L', 'S', '1', SCREEN_WIDTH, SCREEN_HEIGHT};
+    uint8_t x, y, length;
+    emit(header, sizeof(header));
+    for(y = 0; y < SCREEN_HEIGHT; y++)
+    {
+        oledC_readRect(0, y, SCREEN_WIDTH - 1, y, rowBuffer);
+        length = 1;
+        for(x = 1; x < SCREEN_WIDTH; x++)
+        {
+            if(rowBuffer[x] == rowBuffer[x - 1])
+            {
+                length++;
+                continue;
+            }
+            emitRun(emit, rowBuffer[x - 1], length);
+            length = 1;
+        }
+        emitRun(emit, rowBuffer[SCREEN_WIDTH - 1], length);
+    }
+}
@@ -0,0 +1,135 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oledC_scroll.h"
+#include "oledC.h"
+
+#define SCREEN_WIDTH 96
+#define SCREEN_HEIGHT 96
+/* start line that shows GRAM row 0 at the top, see oledC_setDisplayOrientation */
+#define BASE_START_LINE 0x20
+
+static uint8_t scrollOffset = 0;
+
+static void programStartLine(void)
+{
+    uint8_t payload[1];
+    payload[0] = (BASE_START_LINE + scrollOffset) % OLEDC_SCROLL_GRAM_ROWS;
+    oledC_sendCommand(OLEDC_CMD_SET_DISPLAY_START_LINE, payload, 1);
+}
+
+static void selectGramRow(uint8_t row)
+{
+    uint8_t payload[2];
+    oledC_setColumnAddressBounds(0, SCREEN_WIDTH - 1);
+    /* GRAM rows above 95 are only reachable here, so bypass the clamped
+     * row setter and drop the cached window */
+    payload[0] = payload[1] = row;
+    oledC_sendCommand(OLEDC_CMD_SET_ROW_ADDRESS, payload, 2);
+    oledC_invalidateWindow();
+}
+
+static void writeGramRow(uint8_t row, const uint16_t *pixels)
+{
+    selectGramRow(row);
+    oledC_beginWriteSession();
+    oledC_sendPixels(pixels, SCREEN_WIDTH);
+    oledC_endWriteSession();
+}
+
+static void readGramRow(uint8_t row, uint16_t *pixels)
+{
+    selectGramRow(row);
+    oledC_readPixels(pixels, SCREEN_WIDTH);
+}
+
+void oledC_scrollReset(void)
+{
+    static uint16_t carried[SCREEN_WIDTH], moving[SCREEN_WIDTH];
+    uint8_t start, row, source, cycles;
+    /* GRAM row r takes the content of row r + offset. The ring splits into
+     * gcd(offset, 128) cycles, each rotated with one row held aside. */
+    cycles = scrollOffset & -scrollOffset;
+    for(start = 0; start < cycles; start++)
+    {
+        readGramRow(start, carried);
+        for(row = start; ; row = source)
+        {
+            source = (row + scrollOffset) % OLEDC_SCROLL_GRAM_ROWS;
+            if(source == start)
+            {
+                writeGramRow(row, carried);
+                break;
+            }
+            readGramRow(source, moving);
+            writeGramRow(row, moving);
+        }
+    }
+    scrollOffset = 0;
+    programStartLine();
+}
+
+void oledC_scrollUp(uint8_t rows)
+{
+    scrollOffset = (scrollOffset + rows) % OLEDC_SCROLL_GRAM_ROWS;
+    programStartLine();
+}
+
+void oledC_scrollDown(uint8_t rows)
+{
+    rows %= OLEDC_SCROLL_GRAM_ROWS;
+    scrollOffset = (scrollOffset + OLEDC_SCROLL_GRAM_ROWS - rows) % OLEDC_SCROLL_GRAM_ROWS;
+    programStartLine();
+}
+
+uint8_t oledC_scrollGetOffset(void)
+{
+    return scrollOffset;
+}
+
+uint8_t oledC_scrollGramRow(uint8_t y)
+{
+    return (y + scrollOffset) % OLEDC_SCROLL_GRAM_ROWS;
+}
+
+void oledC_scrollWriteRow(uint8_t y, const uint16_t *pixels)
+{
+    if(y >= SCREEN_HEIGHT)
+    {
+        return;
+    }
+    writeGramRow(oledC_scrollGramRow(y), pixels);
+}
+
+void oledC_scrollFillRow(uint8_t y, uint16_t color)
+{
+    if(y >= SCREEN_HEIGHT)
+    {
+        return;
+    }
+    selectGramRow(oledC_scrollGramRow(y));
+    oledC_beginWriteSession();
+    oledC_sendColorRun(color, SCREEN_WIDTH);
+    oledC_endWriteSession();
+}
@@ -0,0 +1,55 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef OLEDC_SCROLL_H
+#define	OLEDC_SCROLL_H
+
+#include <stdint.h>
+
+/* Vertical hardware scrolling through the display start line.
+ * GRAM holds 128 rows of which 96 are visible, so scrolling rotates the
+ * visible window through the GRAM ring: logical screen row y is stored in
+ * GRAM row (y + offset) % 128. The start line scrolls the whole panel.
+ *
+ * Scrolling is exclusive: shapes, text, images and the framebuffer flush
+ * address GRAM rows directly and only land on the right screen rows at
+ * offset 0. While scrolled, draw with the row functions below only. */
+
+#define OLEDC_SCROLL_GRAM_ROWS 128
+
+/* Back to offset 0, where logical rows equal GRAM rows again. The GRAM
+ * content is rotated along (read back and rewritten row by row), so the
+ * screen looks the same and the regular drawing functions can be used. */
+void oledC_scrollReset(void);
+/* Moves the content up by rows lines; logical rows 96-rows..95 are exposed
+ * and must be redrawn by the caller */
+void oledC_scrollUp(uint8_t rows);
+/* Moves the content down by rows lines; logical rows 0..rows-1 are exposed */
+void oledC_scrollDown(uint8_t rows);
+uint8_t oledC_scrollGetOffset(void);
+uint8_t oledC_scrollGramRow(uint8_t y);
+
+/* Write one full logical row (96 pixels) at the current scroll offset */
+void oledC_scrollWriteRow(uint8_t y, const uint16_t *pixels);
+void oledC_scrollFillRow(uint8_t y, uint16_t color);
+
+#endif	/* OLEDC_SCROLL_H */
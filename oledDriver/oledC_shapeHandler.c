@@ -22,60 +22,897 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include "oledC_shapeHandler.h"
 #include "oledC_shapes.h"
+#include "oledC_band.h"
+#include "oledC_damage.h"
+#include "oledC.h"
 
-#define MAX_NUMBER_OF_SHAPES 32
+#define MAX_NUMBER_OF_SHAPES OLEDC_MAX_SHAPES
+#define SHAPE_PALETTE_SIZE 16
 
-static void dummyshape(shape_t *shape)
+/* Packed shape record. tag holds the type in bits 0-2, the visible flag in
+ * bit 3 and the palette index of the colour in bits 4-7. data holds the
+ * 8-bit fields in shape_params_t order; characters, strings and bitmaps
+ * keep both scales in one byte (scale_x in the low nibble) and strings and
+ * bitmaps keep the arena offset of their payload in data[4..5]. */
+typedef struct
 {
-}
+    uint8_t tag;
+    uint8_t data[6];
+} shape_t;
+
+#define TAG_TYPE(tag) ((enum OLEDC_SHAPE)((tag) & 0x07))
+#define TAG_VISIBLE 0x08
+#define TAG_COLOR(tag) ((tag) >> 4)
 
+/* Fixed pool linked in z-order: the shape at head is drawn first, tail is on
+ * top. Handles are pool indices and stay valid until the shape is deleted;
+ * unused slots are chained through next[] on the free list. */
 static shape_t allParsedShapes[MAX_NUMBER_OF_SHAPES];
+static uint8_t next[MAX_NUMBER_OF_SHAPES];
+static uint8_t prev[MAX_NUMBER_OF_SHAPES];
+static uint8_t head = OLEDC_SHAPE_NONE;
+static uint8_t tail = OLEDC_SHAPE_NONE;
+static uint8_t freeHead = OLEDC_SHAPE_NONE;
+static bool poolReady = false;
+
+/* Entries are counted by the shapes using them and free again at zero */
+static uint16_t palette[SHAPE_PALETTE_SIZE];
+static uint8_t paletteRefs[SHAPE_PALETTE_SIZE];
+
+/* Strings and bitmaps are copied into the arena in 4-byte steps. Deleted
+ * payloads stay behind as garbage until an allocation reaches the end,
+ * which slides the live payloads down over it. */
+static uint32_t arena[(OLEDC_SHAPE_ARENA_SIZE + 3) / 4];
+static uint16_t arenaTop = 0;
+static uint16_t arenaLive = 0;
+#define ARENA ((uint8_t*)arena)
+#define ARENA_BYTES (sizeof(arena))
+
+/* Compositor state: cached screen bounds per pool slot (xs > xe when the
+ * shape is off screen) and the regions waiting for oledC_composite() */
+static oledC_rect_t bounds[MAX_NUMBER_OF_SHAPES];
+static oledC_damageList_t sceneDamage;
+static uint16_t backgroundColor = 0;
+
+/* Occlusion culling scratch, indexed by handle: how many occluders lie
+ * above the shape, or CULL_HIDDEN when they cover it */
+#define CULL_HIDDEN 0xFF
+static uint8_t cullAbove[MAX_NUMBER_OF_SHAPES];
+static oledC_cullStats_t cullStats;
 
 void initShapesMem(void)
 {
     uint8_t i;
     for(i = 0; i < MAX_NUMBER_OF_SHAPES; i++)
     {
-        allParsedShapes[i].active = false;
-        allParsedShapes[i].draw = dummyshape;
+        allParsedShapes[i].tag = 0;
+        next[i] = i + 1 < MAX_NUMBER_OF_SHAPES ? i + 1 : OLEDC_SHAPE_NONE;
+        prev[i] = OLEDC_SHAPE_NONE;
     }
+    head = tail = OLEDC_SHAPE_NONE;
+    freeHead = 0;
+    memset(paletteRefs, 0, sizeof(paletteRefs));
+    arenaTop = arenaLive = 0;
+    sceneDamage.count = 0;
+    poolReady = true;
 }
 
-void oledC_removeShape(uint8_t drawIndex)
+static void ensurePool(void)
+{
+    if(!poolReady)
+    {
+        initShapesMem();
+    }
+}
+
+static bool isLinked(oledC_shapeHandle_t handle)
+{
+    return handle < MAX_NUMBER_OF_SHAPES && (handle == head || prev[handle] != OLEDC_SHAPE_NONE);
+}
+
+static void unlink(oledC_shapeHandle_t handle)
+{
+    if(prev[handle] != OLEDC_SHAPE_NONE)
+    {
+        next[prev[handle]] = next[handle];
+    }
+    else
+    {
+        head = next[handle];
+    }
+    if(next[handle] != OLEDC_SHAPE_NONE)
+    {
+        prev[next[handle]] = prev[handle];
+    }
+    else
+    {
+        tail = prev[handle];
+    }
+    prev[handle] = next[handle] = OLEDC_SHAPE_NONE;
+}
+
+/* Links handle in front of before, or on top when before is OLEDC_SHAPE_NONE */
+static void linkBefore(oledC_shapeHandle_t handle, oledC_shapeHandle_t before)
+{
+    if(before == OLEDC_SHAPE_NONE)
+    {
+        prev[handle] = tail;
+        next[handle] = OLEDC_SHAPE_NONE;
+        if(tail != OLEDC_SHAPE_NONE)
+        {
+            next[tail] = handle;
+        }
+        else
+        {
+            head = handle;
+        }
+        tail = handle;
+        return;
+    }
+    prev[handle] = prev[before];
+    next[handle] = before;
+    if(prev[before] != OLEDC_SHAPE_NONE)
+    {
+        next[prev[before]] = handle;
+    }
+    else
+    {
+        head = handle;
+    }
+    prev[before] = handle;
+}
+
+static int16_t maxOf(int16_t a, int16_t b)
+{
+    return a > b ? a : b;
+}
+
+/* Exact match or a free entry; once all 16 are taken the closest colour.
+ * Takes a reference on the entry. */
+static uint8_t colorIndex(uint16_t color)
+{
+    uint8_t i, index = SHAPE_PALETTE_SIZE;
+    for(i = 0; i < SHAPE_PALETTE_SIZE; i++)
+    {
+        if(paletteRefs[i] && palette[i] == color)
+        {
+            paletteRefs[i]++;
+            return i;
+        }
+        if(!paletteRefs[i] && index == SHAPE_PALETTE_SIZE)
+        {
+            index = i;
+        }
+    }
+    if(index < SHAPE_PALETTE_SIZE)
+    {
+        palette[index] = color;
+    }
+    else
+    {
+        index = oledC_closestColor(palette, SHAPE_PALETTE_SIZE, color);
+    }
+    paletteRefs[index]++;
+    return index;
+}
+
+uint16_t oledC_shapeStoredColor(uint16_t color)
 {
     uint8_t i;
-    for(i = drawIndex; i < (MAX_NUMBER_OF_SHAPES - 1); i++)
+    for(i = 0; i < SHAPE_PALETTE_SIZE; i++)
     {
-        allParsedShapes[i] = allParsedShapes[i+1];
+        if(!paletteRefs[i] || palette[i] == color)
+        {
+            return color;
+        }
     }
-    allParsedShapes[MAX_NUMBER_OF_SHAPES-1].active = false;
+    return palette[oledC_closestColor(palette, SHAPE_PALETTE_SIZE, color)];
 }
 
-shape_t* oledC_getShape(uint8_t index)
+static void releaseColor(const shape_t *shape)
 {
-    index = index > MAX_NUMBER_OF_SHAPES ? MAX_NUMBER_OF_SHAPES : index;
-    return &allParsedShapes[index];
+    paletteRefs[TAG_COLOR(shape->tag)]--;
 }
 
-void oledC_addShape(uint8_t drawIndex, enum OLEDC_SHAPE shape_type, shape_params_t *params)
+static uint8_t packScale(uint8_t scale_x, uint8_t scale_y)
+{
+    scale_x = scale_x > 15 ? 15 : scale_x;
+    scale_y = scale_y > 15 ? 15 : scale_y;
+    return scale_x | (scale_y << 4);
+}
+
+static uint16_t arenaOffset(const shape_t *shape)
+{
+    return shape->data[4] | ((uint16_t)shape->data[5] << 8);
+}
+
+static void setArenaOffset(shape_t *shape, uint16_t offset)
+{
+    shape->data[4] = offset & 0xFF;
+    shape->data[5] = offset >> 8;
+}
+
+static uint16_t arenaSize(uint16_t length)
+{
+    return (length + 3) & ~3u;
+}
+
+/* Arena bytes held by a stored shape */
+static uint16_t payloadSize(const shape_t *shape)
+{
+    switch(TAG_TYPE(shape->tag))
+    {
+        case OLED_SHAPE_STRING:
+            return arenaSize(strlen((const char*)ARENA + arenaOffset(shape)) + 1);
+        case OLED_SHAPE_BITMAP:
+            return (uint16_t)shape->data[3] * 4;
+        default:
+            return 0;
+    }
+}
+
+/* Slide the live payloads down over the garbage, lowest offset first. A
+ * pointer into a moved payload follows it through *track. */
+static void compactArena(const uint8_t **track)
+{
+    oledC_shapeHandle_t handle, pick;
+    uint16_t top = 0, lowest, offset, size;
+    while(true)
+    {
+        pick = OLEDC_SHAPE_NONE;
+        lowest = 0xFFFF;
+        for(handle = head; handle != OLEDC_SHAPE_NONE; handle = next[handle])
+        {
+            offset = arenaOffset(&allParsedShapes[handle]);
+            if(payloadSize(&allParsedShapes[handle]) && offset >= top && offset < lowest)
+            {
+                lowest = offset;
+                pick = handle;
+            }
+        }
+        if(pick == OLEDC_SHAPE_NONE)
+        {
+            break;
+        }
+        size = payloadSize(&allParsedShapes[pick]);
+        if(*track >= ARENA + lowest && *track < ARENA + lowest + size)
+        {
+            *track -= lowest - top;
+        }
+        memmove(ARENA + top, ARENA + lowest, size);
+        setArenaOffset(&allParsedShapes[pick], top);
+        top += size;
+    }
+    arenaTop = top;
+}
+
+/* Copy the string or bitmap of params into the arena for handle. The old
+ * payload (oldSize bytes) is reused when the new one fits; otherwise it is
+ * released after the copy, so params may point into it. */
+static bool storePayload(oledC_shapeHandle_t handle, enum OLEDC_SHAPE shape_type, const shape_params_t *params, uint16_t oldSize)
+{
+    shape_t *shape = &allParsedShapes[handle];
+    const uint8_t *source;
+    uint16_t length, size, offset;
+    if(shape_type == OLED_SHAPE_STRING)
+    {
+        source = params->string.string ? params->string.string : (const uint8_t*)"";
+        length = strlen((const char*)source) + 1;
+    }
+    else if(shape_type == OLED_SHAPE_BITMAP)
+    {
+        source = (const uint8_t*)params->bitmap.bit_array;
+        length = (uint16_t)params->bitmap.array_length * 4;
+    }
+    else
+    {
+        return true;
+    }
+    size = arenaSize(length);
+    if(size <= oldSize)
+    {
+        offset = arenaOffset(shape);
+    }
+    else
+    {
+        if(arenaTop + size > ARENA_BYTES)
+        {
+            compactArena(&source);
+        }
+        if(arenaTop + size > ARENA_BYTES)
+        {
+            return false;
+        }
+        offset = arenaTop;
+        arenaTop += size;
+    }
+    if(length)
+    {
+        memmove(ARENA + offset, source, length);
+    }
+    arenaLive += size - oldSize;
+    setArenaOffset(shape, offset);
+    return true;
+}
+
+/* Pack everything but the payload; keeps the visible flag and takes a
+ * reference on the palette entry of the colour */
+static void encodeShape(shape_t *shape, enum OLEDC_SHAPE shape_type, const shape_params_t *params)
+{
+    uint8_t *d = shape->data;
+    shape->tag = shape_type | (shape->tag & TAG_VISIBLE) | (colorIndex(params->point.color) << 4);
+    switch(shape_type)
+    {
+        case OLED_SHAPE_CIRCLE:
+            d[0] = params->circle.xc;
+            d[1] = params->circle.yc;
+            d[2] = params->circle.radius;
+            break;
+        case OLED_SHAPE_RING:
+            d[0] = params->ring.x0;
+            d[1] = params->ring.y0;
+            d[2] = params->ring.radius;
+            d[3] = params->ring.width;
+            break;
+        case OLED_SHAPE_RECTANGLE:
+            d[0] = params->rectangle.xs;
+            d[1] = params->rectangle.ys;
+            d[2] = params->rectangle.xe;
+            d[3] = params->rectangle.ye;
+            break;
+        case OLED_SHAPE_LINE:
+            d[0] = params->line.xs;
+            d[1] = params->line.ys;
+            d[2] = params->line.xe;
+            d[3] = params->line.ye;
+            d[4] = params->line.width;
+            break;
+        case OLED_SHAPE_CHARACTER:
+            d[0] = params->character.x;
+            d[1] = params->character.y;
+            d[2] = packScale(params->character.scale_x, params->character.scale_y);
+            d[3] = params->character.character;
+            break;
+        case OLED_SHAPE_STRING:
+            d[0] = params->string.x;
+            d[1] = params->string.y;
+            d[2] = packScale(params->string.scale_x, params->string.scale_y);
+            break;
+        case OLED_SHAPE_BITMAP:
+            d[0] = params->bitmap.x;
+            d[1] = params->bitmap.y;
+            d[2] = packScale(params->bitmap.sx, params->bitmap.sy);
+            d[3] = params->bitmap.array_length;
+            break;
+        default:
+            d[0] = params->point.x;
+            d[1] = params->point.y;
+            break;
+    }
+}
+
+/* Unpack a stored shape; strings and bitmaps point into the arena */
+static enum OLEDC_SHAPE decodeShape(oledC_shapeHandle_t handle, shape_params_t *params)
+{
+    const shape_t *shape = &allParsedShapes[handle];
+    const uint8_t *d = shape->data;
+    enum OLEDC_SHAPE shape_type = TAG_TYPE(shape->tag);
+    memset(params, 0, sizeof(*params));
+    params->point.color = palette[TAG_COLOR(shape->tag)];
+    switch(shape_type)
+    {
+        case OLED_SHAPE_CIRCLE:
+            params->circle.xc = d[0];
+            params->circle.yc = d[1];
+            params->circle.radius = d[2];
+            break;
+        case OLED_SHAPE_RING:
+            params->ring.x0 = d[0];
+            params->ring.y0 = d[1];
+            params->ring.radius = d[2];
+            params->ring.width = d[3];
+            break;
+        case OLED_SHAPE_RECTANGLE:
+            params->rectangle.xs = d[0];
+            params->rectangle.ys = d[1];
+            params->rectangle.xe = d[2];
+            params->rectangle.ye = d[3];
+            break;
+        case OLED_SHAPE_LINE:
+            params->line.xs = d[0];
+            params->line.ys = d[1];
+            params->line.xe = d[2];
+            params->line.ye = d[3];
+            params->line.width = d[4];
+            break;
+        case OLED_SHAPE_CHARACTER:
+            params->character.x = d[0];
+            params->character.y = d[1];
+            params->character.scale_x = d[2] & 0x0F;
+            params->character.scale_y = d[2] >> 4;
+            params->character.character = d[3];
+            break;
+        case OLED_SHAPE_STRING:
+            params->string.x = d[0];
+            params->string.y = d[1];
+            params->string.scale_x = d[2] & 0x0F;
+            params->string.scale_y = d[2] >> 4;
+            params->string.string = ARENA + arenaOffset(shape);
+            break;
+        case OLED_SHAPE_BITMAP:
+            params->bitmap.x = d[0];
+            params->bitmap.y = d[1];
+            params->bitmap.sx = d[2] & 0x0F;
+            params->bitmap.sy = d[2] >> 4;
+            params->bitmap.array_length = d[3];
+            params->bitmap.bit_array = (uint32_t*)(ARENA + arenaOffset(shape));
+            break;
+        default:
+            params->point.x = d[0];
+            params->point.y = d[1];
+            break;
+    }
+    return shape_type;
+}
+
+static void drawShape(oledC_shapeHandle_t handle)
+{
+    shape_params_t params;
+    enum OLEDC_SHAPE shape_type = decodeShape(handle, &params);
+    oledC_drawShape(shape_type, &params);
+}
+
+static bool boundsOk(oledC_shapeHandle_t handle)
+{
+    return bounds[handle].xs <= bounds[handle].xe;
+}
+
+/* Screen area a shape can touch, computed from its parameters */
+static void updateBounds(oledC_shapeHandle_t handle)
+{
+    shape_params_t params;
+    const shape_params_t *p = &params;
+    int16_t xs, ys, xe, ye, r;
+    const uint8_t *c;
+    switch(decodeShape(handle, &params))
+    {
+        case OLED_SHAPE_POINT:
+            xs = xe = p->point.x;
+            ys = ye = p->point.y;
+            break;
+        case OLED_SHAPE_CIRCLE:
+            r = maxOf(p->circle.radius, 1);
+            xs = p->circle.xc - r;
+            xe = p->circle.xc + r;
+            ys = p->circle.yc - r;
+            ye = p->circle.yc + r;
+            break;
+        case OLED_SHAPE_RING:
+            r = p->ring.radius + (p->ring.width >> 1);
+            xs = p->ring.x0 - r;
+            xe = p->ring.x0 + r;
+            ys = p->ring.y0 - r;
+            ye = p->ring.y0 + r;
+            break;
+        case OLED_SHAPE_RECTANGLE:
+            xs = p->rectangle.xs;
+            ys = p->rectangle.ys;
+            xe = p->rectangle.xe;
+            ye = p->rectangle.ye;
+            break;
+        case OLED_SHAPE_LINE:
+            r = p->line.width > 1 ? (p->line.width >> 1) + 1 : 0;
+            xs = (p->line.xs < p->line.xe ? p->line.xs : p->line.xe) - r;
+            xe = maxOf(p->line.xs, p->line.xe) + r;
+            ys = (p->line.ys < p->line.ye ? p->line.ys : p->line.ye) - r;
+            ye = maxOf(p->line.ys, p->line.ye) + r;
+            break;
+        case OLED_SHAPE_CHARACTER:
+            xs = p->character.x;
+            ys = p->character.y;
+            xe = xs + 5 * p->character.scale_x;
+            ye = ys + 9 * p->character.scale_y - 1;
+            break;
+        case OLED_SHAPE_STRING:
+            xs = p->string.x;
+            ys = p->string.y;
+            xe = xs;
+            for(c = p->string.string; c && *c; c++)
+            {
+                xe += 5 * p->string.scale_x + 1;
+            }
+            if(xe > 255)
+            {
+                /* oledC_DrawString() wraps x past 255 */
+                xs = 0;
+            }
+            ye = ys + 9 * p->string.scale_y - 1;
+            break;
+        case OLED_SHAPE_BITMAP:
+            xs = p->bitmap.x;
+            ys = p->bitmap.y;
+            xe = xs + 33 * p->bitmap.sx - 1;
+            ye = ys + p->bitmap.array_length * p->bitmap.sy - 1;
+            break;
+        default:
+            xs = ys = 0;
+            xe = ye = 95;
+            break;
+    }
+    xs = maxOf(xs, 0);
+    ys = maxOf(ys, 0);
+    xe = xe > 95 ? 95 : xe;
+    ye = ye > 95 ? 95 : ye;
+    if(xs > xe || ys > ye)
+    {
+        /* nothing on screen */
+        xs = 1;
+        xe = 0;
+    }
+    bounds[handle].xs = xs;
+    bounds[handle].ys = ys;
+    bounds[handle].xe = xe;
+    bounds[handle].ye = ye;
+}
+
+/* Hidden shapes show nothing, so changing them damages nothing */
+static void damageShape(oledC_shapeHandle_t handle)
+{
+    if(boundsOk(handle) && (allParsedShapes[handle].tag & TAG_VISIBLE))
+    {
+        oledC_damageListAdd(&sceneDamage, bounds[handle].xs, bounds[handle].ys, bounds[handle].xe, bounds[handle].ye);
+    }
+}
+
+static bool intersect(const oledC_rect_t *a, const oledC_rect_t *b, oledC_rect_t *out)
+{
+    out->xs = a->xs > b->xs ? a->xs : b->xs;
+    out->ys = a->ys > b->ys ? a->ys : b->ys;
+    out->xe = a->xe < b->xe ? a->xe : b->xe;
+    out->ye = a->ye < b->ye ? a->ye : b->ye;
+    return out->xs <= out->xe && out->ys <= out->ye;
+}
+
+static uint32_t rectArea(const oledC_rect_t *rect)
+{
+    return (uint32_t)(rect->xe - rect->xs + 1) * (rect->ye - rect->ys + 1);
+}
+
+/* Area a shape is guaranteed to paint solid: a rectangle's own bounds, or
+ * the square inscribed in a filled circle */
+static bool opaqueArea(oledC_shapeHandle_t handle, oledC_rect_t *area)
+{
+    const shape_t *shape = &allParsedShapes[handle];
+    int16_t half, xc, yc;
+    if(!(shape->tag & TAG_VISIBLE) || !boundsOk(handle))
+    {
+        return false;
+    }
+    if(TAG_TYPE(shape->tag) == OLED_SHAPE_RECTANGLE)
+    {
+        *area = bounds[handle];
+        return true;
+    }
+    if(TAG_TYPE(shape->tag) == OLED_SHAPE_CIRCLE && shape->data[2] >= 2)
+    {
+        /* 0.7 r stays inside r / sqrt(2) */
+        xc = shape->data[0];
+        yc = shape->data[1];
+        half = shape->data[2] > 96 ? 96 : shape->data[2];
+        half = half * 7 / 10;
+        area->xs = maxOf(xc - half, 0);
+        area->ys = maxOf(yc - half, 0);
+        area->xe = xc + half > 95 ? 95 : xc + half;
+        area->ye = yc + half > 95 ? 95 : yc + half;
+        return area->xs <= area->xe && area->ys <= area->ye;
+    }
+    return false;
+}
+
+/* Cut an edge strip off visible when occluder spans its full width or
+ * height there */
+static bool trimEdge(oledC_rect_t *visible, const oledC_rect_t *occluder)
+{
+    if(occluder->xs <= visible->xs && occluder->xe >= visible->xe)
+    {
+        if(occluder->ys <= visible->ys && occluder->ye >= visible->ys)
+        {
+            visible->ys = occluder->ye + 1;
+            return true;
+        }
+        if(occluder->ye >= visible->ye && occluder->ys <= visible->ye)
+        {
+            visible->ye = occluder->ys - 1;
+            return true;
+        }
+    }
+    if(occluder->ys <= visible->ys && occluder->ye >= visible->ye)
+    {
+        if(occluder->xs <= visible->xs && occluder->xe >= visible->xs)
+        {
+            visible->xs = occluder->xe + 1;
+            return true;
+        }
+        if(occluder->xe >= visible->xe && occluder->xs <= visible->xe)
+        {
+            visible->xe = occluder->xs - 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* False when the occluders hide all of visible */
+static bool trimVisible(oledC_rect_t *visible, const oledC_rect_t *occluders, uint8_t count)
+{
+    bool changed = true;
+    uint8_t i;
+    while(changed)
+    {
+        changed = false;
+        for(i = 0; i < count; i++)
+        {
+            if(trimEdge(visible, &occluders[i]))
+            {
+                if(visible->xs > visible->xe || visible->ys > visible->ye)
+                {
+                    return false;
+                }
+                changed = true;
+            }
+        }
+    }
+    return true;
+}
+
+/* Draw first..last bottom to top inside area (current local coordinates,
+ * within the panel), skipping whatever the opaque shapes above fully cover.
+ * All tests are on bounding boxes, so a shape is only skipped or trimmed
+ * where it certainly cannot show. */
+static void drawCulled(const oledC_rect_t *area, oledC_shapeHandle_t first, oledC_shapeHandle_t last, bool fillBackground)
+{
+    oledC_rect_t occluders[OLEDC_MAX_OCCLUDERS];
+    oledC_rect_t full, visible;
+    oledC_shapeHandle_t handle;
+    uint8_t occluderCount = 0;
+
+    for(handle = last; handle != OLEDC_SHAPE_NONE; handle = handle == first ? OLEDC_SHAPE_NONE : prev[handle])
+    {
+        cullAbove[handle] = CULL_HIDDEN;
+        if(!(allParsedShapes[handle].tag & TAG_VISIBLE) || !intersect(&bounds[handle], area, &full))
+        {
+            continue;
+        }
+        visible = full;
+        if(trimVisible(&visible, occluders, occluderCount))
+        {
+            cullAbove[handle] = occluderCount;
+            cullStats.pixelsSkipped += rectArea(&full) - rectArea(&visible);
+        }
+        else
+        {
+            cullStats.shapesSkipped++;
+            cullStats.pixelsSkipped += rectArea(&full);
+        }
+        if(occluderCount < OLEDC_MAX_OCCLUDERS && opaqueArea(handle, &full) && intersect(&full, area, &full))
+        {
+            occluders[occluderCount++] = full;
+        }
+    }
+
+    visible = *area;
+    if(fillBackground && trimVisible(&visible, occluders, occluderCount))
+    {
+        oledC_DrawRectangle(visible.xs, visible.ys, visible.xe, visible.ye, backgroundColor);
+    }
+    for(handle = first; handle != OLEDC_SHAPE_NONE; handle = handle == last ? OLEDC_SHAPE_NONE : next[handle])
+    {
+        if(cullAbove[handle] == CULL_HIDDEN)
+        {
+            continue;
+        }
+        /* same occluders in the same order give the same trim as above */
+        intersect(&bounds[handle], area, &full);
+        visible = full;
+        trimVisible(&visible, occluders, cullAbove[handle]);
+        if((visible.xs != full.xs || visible.ys != full.ys || visible.xe != full.xe || visible.ye != full.ye) &&
+            oledC_pushClip(visible.xs, visible.ys, visible.xe - visible.xs + 1, visible.ye - visible.ys + 1))
+        {
+            drawShape(handle);
+            oledC_popViewport();
+        }
+        else
+        {
+            drawShape(handle);
+        }
+    }
+}
+
+static oledC_shapeHandle_t handleAt(uint8_t drawIndex)
+{
+    oledC_shapeHandle_t handle;
+    ensurePool();
+    for(handle = head; handle != OLEDC_SHAPE_NONE && drawIndex > 0; drawIndex--)
+    {
+        handle = next[handle];
+    }
+    return handle;
+}
+
+oledC_shapeHandle_t oledC_insertShape(enum OLEDC_SHAPE shape_type, const shape_params_t *params, oledC_shapeHandle_t before)
+{
+    oledC_shapeHandle_t handle;
+    ensurePool();
+    if(freeHead == OLEDC_SHAPE_NONE || (before != OLEDC_SHAPE_NONE && !isLinked(before)))
+    {
+        return OLEDC_SHAPE_NONE;
+    }
+    handle = freeHead;
+    if(!storePayload(handle, shape_type, params, 0))
+    {
+        return OLEDC_SHAPE_NONE;
+    }
+    freeHead = next[handle];
+    allParsedShapes[handle].tag = TAG_VISIBLE;
+    encodeShape(&allParsedShapes[handle], shape_type, params);
+    linkBefore(handle, before);
+    updateBounds(handle);
+    damageShape(handle);
+    return handle;
+}
+
+void oledC_deleteShape(oledC_shapeHandle_t handle)
+{
+    if(!isLinked(handle))
+    {
+        return;
+    }
+    damageShape(handle);
+    arenaLive -= payloadSize(&allParsedShapes[handle]);
+    releaseColor(&allParsedShapes[handle]);
+    unlink(handle);
+    allParsedShapes[handle].tag = 0;
+    next[handle] = freeHead;
+    freeHead = handle;
+}
+
+void oledC_moveShape(oledC_shapeHandle_t handle, oledC_shapeHandle_t before)
+{
+    if(!isLinked(handle) || handle == before || (before != OLEDC_SHAPE_NONE && !isLinked(before)))
+    {
+        return;
+    }
+    unlink(handle);
+    linkBefore(handle, before);
+    damageShape(handle);
+}
+
+bool oledC_getShapeParams(oledC_shapeHandle_t handle, enum OLEDC_SHAPE *shape_type, shape_params_t *params)
+{
+    if(!isLinked(handle))
+    {
+        return false;
+    }
+    *shape_type = decodeShape(handle, params);
+    return true;
+}
+
+bool oledC_updateShape(oledC_shapeHandle_t handle, const shape_params_t *params)
+{
+    shape_t *shape = &allParsedShapes[handle];
+    if(!isLinked(handle) || !storePayload(handle, TAG_TYPE(shape->tag), params, payloadSize(shape)))
+    {
+        return false;
+    }
+    damageShape(handle);
+    releaseColor(shape);
+    encodeShape(shape, TAG_TYPE(shape->tag), params);
+    updateBounds(handle);
+    damageShape(handle);
+    return true;
+}
+
+void oledC_setShapeVisible(oledC_shapeHandle_t handle, bool visible)
+{
+    if(isLinked(handle) && !(allParsedShapes[handle].tag & TAG_VISIBLE) == visible)
+    {
+        /* damaged while visible: the old area when hiding, the new one when showing */
+        if(!visible)
+        {
+            damageShape(handle);
+        }
+        allParsedShapes[handle].tag ^= TAG_VISIBLE;
+        if(visible)
+        {
+            damageShape(handle);
+        }
+    }
+}
+
+void oledC_setBackground(uint16_t color)
+{
+    backgroundColor = color;
+    oledC_damageListAdd(&sceneDamage, 0, 0, 95, 95);
+}
+
+bool oledC_sceneDirty(void)
+{
+    return sceneDamage.count > 0;
+}
+
+void oledC_composite(void)
 {
     uint8_t i;
-    shape_t *newShape;
-    drawIndex = drawIndex >= MAX_NUMBER_OF_SHAPES ? (MAX_NUMBER_OF_SHAPES-1) : drawIndex;
-    for(i = (MAX_NUMBER_OF_SHAPES-1); i > drawIndex && i > 0; i--)
+    ensurePool();
+    for(i = 0; i < sceneDamage.count; i++)
     {
-        allParsedShapes[i] = allParsedShapes[i-1];
-    }   
-    
-    newShape = &allParsedShapes[drawIndex];
-    oledC_createShape(shape_type, params, newShape);
+        const oledC_rect_t *rect = &sceneDamage.rects[i];
+        oledC_pushClip(rect->xs, rect->ys, rect->xe - rect->xs + 1, rect->ye - rect->ys + 1);
+        drawCulled(rect, head, tail, true);
+        oledC_popViewport();
+    }
+    sceneDamage.count = 0;
+}
+
+oledC_shapeHandle_t oledC_firstShape(void)
+{
+    ensurePool();
+    return head;
+}
+
+oledC_shapeHandle_t oledC_nextShape(oledC_shapeHandle_t handle)
+{
+    return isLinked(handle) ? next[handle] : OLEDC_SHAPE_NONE;
+}
+
+void oledC_shapeStoreStats(oledC_shapeStoreStats_t *stats)
+{
+    oledC_shapeHandle_t handle;
+    uint8_t i;
+    ensurePool();
+    stats->shapes = 0;
+    for(handle = head; handle != OLEDC_SHAPE_NONE; handle = next[handle])
+    {
+        stats->shapes++;
+    }
+    stats->capacity = MAX_NUMBER_OF_SHAPES;
+    stats->bytesPerShape = sizeof(shape_t) + sizeof(next[0]) + sizeof(prev[0]) + sizeof(bounds[0]) + sizeof(cullAbove[0]);
+    stats->colors = 0;
+    for(i = 0; i < SHAPE_PALETTE_SIZE; i++)
+    {
+        stats->colors += paletteRefs[i] ? 1 : 0;
+    }
+    stats->arenaLive = arenaLive;
+    stats->arenaTop = arenaTop;
+    stats->arenaSize = ARENA_BYTES;
+}
+
+void oledC_removeShape(uint8_t drawIndex)
+{
+    oledC_deleteShape(handleAt(drawIndex));
+}
+
+void oledC_addShape(uint8_t drawIndex, enum OLEDC_SHAPE shape_type, shape_params_t *params)
+{
+    ensurePool();
+    if(freeHead == OLEDC_SHAPE_NONE)
+    {
+        /* full: the top shape falls off, as it did with the shifting array */
+        oledC_deleteShape(tail);
+    }
+    oledC_insertShape(shape_type, params, handleAt(drawIndex));
 }
 
 void oledC_redrawIndex(uint8_t indShape)
 {
-    allParsedShapes[indShape].draw(&allParsedShapes[indShape]);
+    oledC_shapeHandle_t handle = handleAt(indShape);
+    if(handle != OLEDC_SHAPE_NONE)
+    {
+        drawShape(handle);
+    }
 }
 
 void oledC_redrawTo(uint8_t endInd)
@@ -90,34 +927,76 @@ void oledC_redrawFrom(uint8_t startInd)
 
 void oledC_redrawSome(uint8_t startInd, uint8_t endInd)
 {
+    oledC_shapeHandle_t first = handleAt(startInd);
+    oledC_shapeHandle_t last = first;
+    oledC_shapeHandle_t handle;
+    oledC_rect_t area;
+    int16_t xs, ys, xe, ye;
     uint8_t i;
-    endInd = endInd > MAX_NUMBER_OF_SHAPES ? MAX_NUMBER_OF_SHAPES : endInd;
-    for(i = startInd; i < endInd; i++)
+    if(first == OLEDC_SHAPE_NONE || startInd >= endInd)
+    {
+        return;
+    }
+    for(i = startInd + 1; i < endInd && next[last] != OLEDC_SHAPE_NONE; i++)
+    {
+        last = next[last];
+    }
+    oledC_getClip(&xs, &ys, &xe, &ye);
+    if(xs >= 0 && ys >= 0 && xe <= 95 && ye <= 95 && xs <= xe && ys <= ye)
     {
-        if(allParsedShapes[i].active)
+        area.xs = xs;
+        area.ys = ys;
+        area.xe = xe;
+        area.ye = ye;
+        drawCulled(&area, first, last, false);
+        return;
+    }
+    /* bounds are only kept for the panel area, draw without culling */
+    for(handle = first; handle != OLEDC_SHAPE_NONE; handle = handle == last ? OLEDC_SHAPE_NONE : next[handle])
+    {
+        if(allParsedShapes[handle].tag & TAG_VISIBLE)
         {
-            allParsedShapes[i].draw(&allParsedShapes[i]);
+            drawShape(handle);
         }
     }
 }
 
+const oledC_cullStats_t* oledC_cullStats(void)
+{
+    return &cullStats;
+}
+
+void oledC_cullStatsReset(void)
+{
+    cullStats.shapesSkipped = 0;
+    cullStats.pixelsSkipped = 0;
+}
+
+static void eraseShape(oledC_shapeHandle_t handle, uint16_t eraseColor)
+{
+    shape_params_t params;
+    enum OLEDC_SHAPE shape_type = decodeShape(handle, &params);
+    params.point.color = eraseColor;
+    oledC_drawShape(shape_type, &params);
+}
+
 void oledC_eraseShape(uint8_t indShape,uint16_t eraseColor)
 {
-    shape_t* ourShape = oledC_getShape(indShape);
-    uint16_t saveColor = ourShape->params.point.color;
-    ourShape->params.point.color = eraseColor;
-    ourShape->draw(ourShape);
-    ourShape->params.point.color = saveColor;
+    oledC_shapeHandle_t handle = handleAt(indShape);
+    if(handle != OLEDC_SHAPE_NONE)
+    {
+        eraseShape(handle, eraseColor);
+    }
 }
 
 void oledC_eraseAll(uint16_t eraseColor)
 {
-    uint8_t i;
-    for(i = 0; i < MAX_NUMBER_OF_SHAPES; i++)
+    oledC_shapeHandle_t handle;
+    for(handle = oledC_firstShape(); handle != OLEDC_SHAPE_NONE; handle = next[handle])
     {
-        if(allParsedShapes[i].active)
+        if(allParsedShapes[handle].tag & TAG_VISIBLE)
         {
-            oledC_eraseShape(i,eraseColor);
+            eraseShape(handle, eraseColor);
         }
     }
 }
@@ -126,3 +1005,11 @@ void oledC_redrawAll(void)
 {
     oledC_redrawSome(0,MAX_NUMBER_OF_SHAPES);
 }
+
+#if OLEDC_USE_BANDS
+/* each band only draws the shapes whose bounds reach its rows */
+bool oledC_renderAllBanded(uint16_t background)
+{
+    return oledC_renderBands(background, oledC_redrawAll);
+}
+#endif
@@ -24,9 +24,94 @@
 #define	OLEDC_SHAPE_HANDLER_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "oledC_shapes.h"
+#include "oledC_band.h"
 
+#ifndef OLEDC_MAX_SHAPES
+#define OLEDC_MAX_SHAPES 64
+#endif
+
+/* Bytes shared by the string and bitmap payloads of all shapes */
+#ifndef OLEDC_SHAPE_ARENA_SIZE
+#define OLEDC_SHAPE_ARENA_SIZE 256
+#endif
+
+/* Opaque shapes tracked per redraw pass for occlusion culling */
+#ifndef OLEDC_MAX_OCCLUDERS
+#define OLEDC_MAX_OCCLUDERS 8
+#endif
+
+/* Stable reference to a shape in the scene list */
+typedef uint8_t oledC_shapeHandle_t;
+#define OLEDC_SHAPE_NONE 0xFF
+
+void initShapesMem(void);
+/* O(1) scene list: insert in front of before (OLEDC_SHAPE_NONE puts the
+ * shape on top), delete, and move to another z position. Insert returns
+ * OLEDC_SHAPE_NONE when the pool or the payload arena is full.
+ *
+ * Shapes are stored packed: coordinates as bytes, scales up to 15 and the
+ * colour as an index into a 16 entry palette (further colours map to the
+ * closest entry). Strings and bitmaps are copied into the arena, so the
+ * caller's buffers may be reused right after the call. */
+oledC_shapeHandle_t oledC_insertShape(enum OLEDC_SHAPE shape_type, const shape_params_t *params, oledC_shapeHandle_t before);
+void oledC_deleteShape(oledC_shapeHandle_t handle);
+void oledC_moveShape(oledC_shapeHandle_t handle, oledC_shapeHandle_t before);
+/* Decoded copy; string and bit_array point into the arena and stay valid
+ * until the next insert or update */
+bool oledC_getShapeParams(oledC_shapeHandle_t handle, enum OLEDC_SHAPE *shape_type, shape_params_t *params);
+/* Replace the params of a shape, keeping its type and z position. False
+ * when the new payload does not fit. */
+bool oledC_updateShape(oledC_shapeHandle_t handle, const shape_params_t *params);
+/* Colour a shape asking for color would be stored with right now: color
+ * itself, or its palette substitute once all entries are taken */
+uint16_t oledC_shapeStoredColor(uint16_t color);
+
+typedef struct oledC_shapeStoreStats_t
+{
+    uint8_t shapes;
+    uint8_t capacity;
+    uint8_t bytesPerShape;
+    uint8_t colors;
+    uint16_t arenaLive;
+    uint16_t arenaTop;
+    uint16_t arenaSize;
+} oledC_shapeStoreStats_t;
+
+/* Memory accounting: pool RAM is capacity * bytesPerShape, arenaTop minus
+ * arenaLive is garbage waiting for compaction */
+void oledC_shapeStoreStats(oledC_shapeStoreStats_t *stats);
+
+/* Compositor: inserts, deletes, moves, updates and visibility changes
+ * damage the cached bounds of a shape. oledC_composite() then repaints only
+ * the damaged regions: background first, then every intersecting shape in
+ * z-order, clipped to the region. */
+void oledC_setShapeVisible(oledC_shapeHandle_t handle, bool visible);
+void oledC_setBackground(uint16_t color);
+bool oledC_sceneDirty(void);
+void oledC_composite(void);
+
+/* Redraw passes and the compositor treat rectangles and filled circles as
+ * occluders and skip, or clip away, whatever they fully cover */
+typedef struct oledC_cullStats_t
+{
+    uint16_t shapesSkipped;
+    uint32_t pixelsSkipped;
+} oledC_cullStats_t;
+
+const oledC_cullStats_t* oledC_cullStats(void);
+void oledC_cullStatsReset(void);
+
+/* Bottom to top iteration */
+oledC_shapeHandle_t oledC_firstShape(void);
+oledC_shapeHandle_t oledC_nextShape(oledC_shapeHandle_t handle);
+
+/* Index based calls address the n-th shape from the bottom */
 void oledC_redrawAll(void);
+#if OLEDC_USE_BANDS
+bool oledC_renderAllBanded(uint16_t background);
+#endif
 void oledC_redrawTo(uint8_t endInd);
 void oledC_redrawSome(uint8_t startInd, uint8_t endInd);
 void oledC_redrawFrom(uint8_t startInd);
@@ -35,7 +120,6 @@ void oledC_addShape(uint8_t drawIndex, enum OLEDC_SHAPE shape_type, shape_params
 void oledC_removeShape(uint8_t drawIndex);
 void oledC_eraseShape(uint8_t indShape, uint16_t eraseColor);
 void oledC_eraseAll(uint16_t eraseColor);
-shape_t* oledC_getShape(uint8_t index);
 
 #endif	/* OLEDC_SHAPE_HANDLER_H */
 
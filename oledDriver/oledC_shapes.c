@@ -20,67 +20,163 @@
     TERMS.
  */
 
+#include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include "oledC_shapes.h"
 #include "oledC.h"
+#include "oledC_framebuffer.h"
+#include "oledC_band.h"
+
+/* a cached disk has to fit the 96 rows of the panel */
+#if OLEDC_CIRCLE_CACHE_RADIUS > 47
+#error "OLEDC_CIRCLE_CACHE_RADIUS must be 47 or less"
+#endif
 
-static const uint8_t OLED_DIM_WIDTH = 0x5F;
 static const uint8_t OLED_DIM_HEIGHT = 0x5F;
 static const uint8_t OLED_FONT_WIDTH = 0x5;
 static const uint8_t OLED_FONT_HEIGHT = 0x8;
 
-static void drawPoint(shape_t *shape);
-static void drawCircle(shape_t *shape);
-static void drawRing(shape_t *shape);
-static void drawRectangle(shape_t *shape);
-static void drawLine(shape_t *shape);
-static void drawCharacter(shape_t *shape);
-static void drawString(shape_t *shape);
-//static void drawString(shape_t *shape);
-static void drawBitmap(shape_t *shape);
+static enum OLEDC_DRAW_TARGET drawTarget = OLEDC_TARGET_PANEL;
+
+/* Viewport stack: primitives take local coordinates relative to origin and
+ * only pixels inside the clip rectangle (screen coordinates) reach the panel */
+typedef struct
+{
+    int16_t originX, originY;
+    int16_t clipXs, clipYs, clipXe, clipYe;
+} viewport_t;
+
+static viewport_t viewports[OLEDC_VIEWPORT_DEPTH + 1] = {{0, 0, 0, 0, 0x5F, 0x5F}};
+static uint8_t viewportDepth = 0;
+#define VIEWPORT (viewports[viewportDepth])
 
 
-void oledC_createShape(enum OLEDC_SHAPE shape_type, shape_params_t *params, shape_t *newShape)
+void oledC_setDrawTarget(enum OLEDC_DRAW_TARGET target)
 {
-    newShape->_type = shape_type;
-    newShape->active = true;
-    
-    newShape->params.point = params->point;
-    switch(shape_type)
+    /* targets left out of the build draw straight to the panel */
+    drawTarget = (target == OLEDC_TARGET_FRAMEBUFFER && !OLEDC_USE_FRAMEBUFFER) ||
+        (target == OLEDC_TARGET_BAND && !OLEDC_USE_BANDS) ? OLEDC_TARGET_PANEL : target;
+}
+
+enum OLEDC_DRAW_TARGET oledC_getDrawTarget(void)
+{
+    return drawTarget;
+}
+
+static bool pushViewport(const viewport_t *parent, int16_t x, int16_t y, uint8_t width, uint8_t height, bool moveOrigin)
+{
+    viewport_t *child;
+    int16_t xs = parent->originX + x, ys = parent->originY + y;
+    if(viewportDepth >= OLEDC_VIEWPORT_DEPTH)
     {
-        case OLED_SHAPE_CIRCLE:
-            newShape->params.circle = params->circle;
-            newShape->draw = drawCircle;
-            break;
-        case OLED_SHAPE_RING:
-            newShape->params.ring = params->ring;
-            newShape->draw = drawRing;
-            break;
-        case OLED_SHAPE_RECTANGLE:
-            newShape->params.rectangle = params->rectangle;
-            newShape->draw = drawRectangle;
-            break;
-        case OLED_SHAPE_LINE:
-            newShape->params.line = params->line;
-            newShape->draw = drawLine;
-            break;
-        case OLED_SHAPE_CHARACTER:
-            newShape->params.character = params->character;
-            newShape->draw = drawCharacter;
-            break;
-        case OLED_SHAPE_STRING:
-            newShape->params.string = params->string;
-            newShape->draw = drawString;
-            break;
-        case OLED_SHAPE_BITMAP:
-            newShape->params.bitmap = params->bitmap;
-            newShape->draw = drawBitmap;
-            break;
-        default: 
-            newShape->draw = drawPoint;
+        return false;
+    }
+    child = &viewports[++viewportDepth];
+    child->originX = moveOrigin ? xs : parent->originX;
+    child->originY = moveOrigin ? ys : parent->originY;
+    child->clipXs = xs > parent->clipXs ? xs : parent->clipXs;
+    child->clipYs = ys > parent->clipYs ? ys : parent->clipYs;
+    child->clipXe = xs + width - 1 < parent->clipXe ? xs + width - 1 : parent->clipXe;
+    child->clipYe = ys + height - 1 < parent->clipYe ? ys + height - 1 : parent->clipYe;
+    return true;
+}
+
+bool oledC_pushViewport(int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+    return pushViewport(&VIEWPORT, x, y, width, height, true);
+}
+
+bool oledC_pushClip(int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+    return pushViewport(&VIEWPORT, x, y, width, height, false);
+}
+
+bool oledC_pushScreenClip(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    return pushViewport(&viewports[0], x, y, width, height, false);
+}
+
+void oledC_popViewport(void)
+{
+    if(viewportDepth > 0)
+    {
+        viewportDepth--;
+    }
+}
+
+void oledC_resetViewport(void)
+{
+    viewportDepth = 0;
+}
+
+void oledC_getClip(int16_t *start_x, int16_t *start_y, int16_t *end_x, int16_t *end_y)
+{
+    *start_x = VIEWPORT.clipXs - VIEWPORT.originX;
+    *start_y = VIEWPORT.clipYs - VIEWPORT.originY;
+    *end_x = VIEWPORT.clipXe - VIEWPORT.originX;
+    *end_y = VIEWPORT.clipYe - VIEWPORT.originY;
+}
+
+bool oledC_viewportWindow(int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t *screen_x, uint8_t *screen_y)
+{
+    int16_t xs = VIEWPORT.originX + x, ys = VIEWPORT.originY + y;
+    if(width == 0 || height == 0 || xs < VIEWPORT.clipXs || ys < VIEWPORT.clipYs ||
+        xs + width - 1 > VIEWPORT.clipXe || ys + height - 1 > VIEWPORT.clipYe)
+    {
+        return false;
+    }
+    *screen_x = xs;
+    *screen_y = ys;
+    return true;
+}
+
+/* Moves a local rectangle to the screen and clips it; false if nothing is left */
+static bool clipRect(int16_t *start_x, int16_t *start_y, int16_t *end_x, int16_t *end_y)
+{
+    *start_x += VIEWPORT.originX;
+    *end_x += VIEWPORT.originX;
+    *start_y += VIEWPORT.originY;
+    *end_y += VIEWPORT.originY;
+    *start_x = *start_x < VIEWPORT.clipXs ? VIEWPORT.clipXs : *start_x;
+    *start_y = *start_y < VIEWPORT.clipYs ? VIEWPORT.clipYs : *start_y;
+    *end_x = *end_x > VIEWPORT.clipXe ? VIEWPORT.clipXe : *end_x;
+    *end_y = *end_y > VIEWPORT.clipYe ? VIEWPORT.clipYe : *end_y;
+    return *start_x <= *end_x && *start_y <= *end_y;
+}
+
+/* Narrows local rows start_y..end_y to the clip, so rasterizers only walk
+ * the rows that can show (e.g. the current band); false if none is left */
+static bool clipRows(int16_t *start_y, int16_t *end_y)
+{
+    int16_t top = VIEWPORT.clipYs - VIEWPORT.originY;
+    int16_t bottom = VIEWPORT.clipYe - VIEWPORT.originY;
+    *start_y = *start_y < top ? top : *start_y;
+    *end_y = *end_y > bottom ? bottom : *end_y;
+    return *start_y <= *end_y;
+}
+
+/* The single sink for filled areas, in clipped screen coordinates */
+static void fillScreenRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    switch(drawTarget)
+    {
+#if OLEDC_USE_FRAMEBUFFER
+        case OLEDC_TARGET_FRAMEBUFFER:
+            oledC_fbFillRect(start_x, start_y, end_x, end_y, color);
+            return;
+#endif
+#if OLEDC_USE_BANDS
+        case OLEDC_TARGET_BAND:
+            oledC_bandFillRect(start_x, start_y, end_x, end_y, color);
+            return;
+#endif
+        default:
             break;
     }
+    oledC_setColumnAddressBounds(start_x,end_x);
+    oledC_setRowAddressBounds(start_y,end_y);
+    oledC_sendColorRun(color, (uint16_t)(end_x - start_x + 1) * (end_y - start_y + 1));
 }
 
 static const uint8_t font[] = 
@@ -122,187 +218,500 @@ static const uint8_t font[] =
     0x40,0x80,0x40,0x20,0x40                                                    //  '~
     };
 
-static uint8_t coerceAddressAdditionWithinRange(uint8_t base_address, int8_t adder)
+uint16_t oledC_ReadPoint(uint8_t local_x, uint8_t local_y)
 {
-    int16_t additionResult = base_address+adder;
-    if(additionResult > (int16_t)OLED_DIM_WIDTH)
-    {
-        return OLED_DIM_WIDTH;
-    } 
-    if(additionResult < (int16_t) 0x00) 
+    int16_t x = local_x, y = local_y, end_x = local_x, end_y = local_y;
+    if(!clipRect(&x, &y, &end_x, &end_y))
     {
-        return 0x00;
+        return 0;
     }
-    return (uint8_t) (base_address+adder);
-}
-
-uint16_t oledC_ReadPoint(uint8_t x, uint8_t y)
-{
-    if(x > OLED_DIM_WIDTH || y > OLED_DIM_HEIGHT)
+    switch(drawTarget)
     {
-        return 0;
+#if OLEDC_USE_FRAMEBUFFER
+        case OLEDC_TARGET_FRAMEBUFFER:
+            return oledC_fbGetPixel(x, y);
+#endif
+#if OLEDC_USE_BANDS
+        case OLEDC_TARGET_BAND:
+            return oledC_bandGetPixel(x, y);
+#endif
+        default:
+            break;
     }
     oledC_setColumnAddressBounds(x,95);
     oledC_setRowAddressBounds(y,95);
     return oledC_readColor();
 }
 
-void oledC_DrawPoint(uint8_t x, uint8_t y, uint16_t color)
+void oledC_DrawPoint(uint8_t local_x, uint8_t local_y, uint16_t color)
 {
-    if(x > OLED_DIM_WIDTH || y > OLED_DIM_HEIGHT)
+    int16_t x = local_x, y = local_y, end_x = local_x, end_y = local_y;
+    if(!clipRect(&x, &y, &end_x, &end_y))
     {
         return;
     }
-    oledC_setColumnAddressBounds(x,95);
-    oledC_setRowAddressBounds(y,95);
+    switch(drawTarget)
+    {
+#if OLEDC_USE_FRAMEBUFFER
+        case OLEDC_TARGET_FRAMEBUFFER:
+            oledC_fbSetPixel(x, y, color);
+            return;
+#endif
+#if OLEDC_USE_BANDS
+        case OLEDC_TARGET_BAND:
+            oledC_bandSetPixel(x, y, color);
+            return;
+#endif
+        default:
+            break;
+    }
+    oledC_setPixelAddress(x, y);
     oledC_sendColorInt(color);
 }
 
-void oledC_DrawThickPoint(uint8_t center_x, uint8_t center_y, uint8_t width, uint16_t color)
+static void drawHSpan(int16_t start_x, int16_t end_x, int16_t y, uint16_t color)
 {
-    uint8_t max_x,min_x,max_y, min_y;
-    uint8_t x, y, dx, dy;
-    if((center_x-width) > OLED_DIM_WIDTH || (center_y-width) > OLED_DIM_HEIGHT)
+    int16_t end_y = y;
+    if(clipRect(&start_x, &y, &end_x, &end_y))
     {
-        return;
+        fillScreenRect(start_x, y, end_x, end_y, color);
     }
-    width = (width <= 1) ? 1 : width;
-    max_x = coerceAddressAdditionWithinRange(center_x, width);
-    min_x = coerceAddressAdditionWithinRange(center_x, -(width));
-    max_y = coerceAddressAdditionWithinRange(center_y, width);
-    min_y = coerceAddressAdditionWithinRange(center_y, -(width));
-    
-    for(x = min_x; x < max_x; x++)
+}
+
+void oledC_DrawThickPoint(uint8_t x0, uint8_t y0, uint8_t width, uint16_t color)
+{
+    /* disc of radius width, one clipped span per row */
+    uint32_t limit;
+    int16_t y, row, halfWidth = 0;
+    width = width <= 1 ? 1 : width;
+    limit = (uint32_t)width * width;
+    for(y = -(int16_t)width; y <= width; y++)
     {
-        dx = (center_x >= x) ? (center_x-x) : (x - center_x);
-        for(y = min_y; y < max_y; y++)
+        row = y < 0 ? -y : y;
+        while(halfWidth < width && (uint32_t)(halfWidth + 1) * (halfWidth + 1) + (uint32_t)row * row <= limit)
         {
-            dy = (center_y >= y) ? (center_y-y) : (y - center_y);
-            if(((dy+dx) <= width)|| (dy*dy+dx*dx) <= (width*width))
-            {
-                oledC_DrawPoint(x, y, color);
-            }
+            halfWidth++;
+        }
+        while((uint32_t)halfWidth * halfWidth + (uint32_t)row * row > limit)
+        {
+            halfWidth--;
         }
+        drawHSpan((int16_t)x0 - halfWidth, (int16_t)x0 + halfWidth, (int16_t)y0 + y, color);
     }
 }
 
+/* Half-widths of the disk rows 0..radius: the widest x with
+ * x*x + y*y <= radius*radius + radius, walked midpoint style */
+static void computeCircleSpans(uint8_t radius, uint8_t *halfWidth)
+{
+    uint16_t limit = (uint16_t)radius * radius + radius;
+    uint8_t x = radius, y;
+    for(y = 0; y <= radius; y++)
+    {
+        while((uint16_t)x * x + (uint16_t)y * y > limit)
+        {
+            x--;
+        }
+        halfWidth[y] = x;
+    }
+}
+
+/* The tables of radius r hold r + 1 rows and are packed one after the
+ * other, radius r starting at r * (r + 1) / 2 */
+#define SPAN_CACHE_SIZE ((OLEDC_CIRCLE_CACHE_RADIUS + 1) * (OLEDC_CIRCLE_CACHE_RADIUS + 2) / 2)
+
+static const uint8_t *circleSpans(uint8_t radius)
+{
+    static uint8_t spanCache[SPAN_CACHE_SIZE];
+    static uint8_t spanCacheValid[OLEDC_CIRCLE_CACHE_RADIUS / 8 + 1];
+    static uint8_t spans[96];
+    uint8_t *cached;
+    if(radius > OLEDC_CIRCLE_CACHE_RADIUS)
+    {
+        computeCircleSpans(radius, spans);
+        return spans;
+    }
+    cached = &spanCache[(uint16_t)radius * (radius + 1) / 2];
+    if(!(spanCacheValid[radius >> 3] & (1u << (radius & 7))))
+    {
+        computeCircleSpans(radius, cached);
+        spanCacheValid[radius >> 3] |= 1u << (radius & 7);
+    }
+    return cached;
+}
+
 void oledC_DrawCircle(uint8_t x0, uint8_t y0, uint8_t radius, uint16_t color)
 {
-    int8_t xCurr, yMax = 0, y = 0, x=0;
-    int16_t d = 0;
-   
+    const uint8_t *halfWidth;
+    int16_t y, top, bottom;
+    uint8_t row;
+
     radius = radius <= 1 ? 1 : radius;
-    xCurr = radius+1;
-    yMax = 0;
-    y = 0;
-    d = 0;
+    radius = radius > OLED_DIM_HEIGHT ? OLED_DIM_HEIGHT : radius;
+    top = (int16_t)y0 - radius;
+    bottom = (int16_t)y0 + radius;
+    if(!clipRows(&top, &bottom))
+    {
+        return;
+    }
+    halfWidth = circleSpans(radius);
+    for(y = top; y <= bottom; y++)
+    {
+        row = y < y0 ? y0 - y : y - y0;
+        drawHSpan((int16_t)x0 - halfWidth[row], (int16_t)x0 + halfWidth[row], y, color);
+    }
+}
+
+/* sin(0..90 degrees) * 255 */
+static const uint8_t sinTable[91] = {
+      0,  4,  9, 13, 18, 22, 27, 31, 35, 40,
+     44, 49, 53, 57, 62, 66, 70, 75, 79, 83,
+     87, 91, 96,100,104,108,112,116,120,124,
+    127,131,135,139,143,146,150,153,157,160,
+    164,167,171,174,177,180,183,186,190,192,
+    195,198,201,204,206,209,211,214,216,219,
+    221,223,225,227,229,231,233,235,236,238,
+    240,241,243,244,245,246,247,248,249,250,
+    251,252,253,253,254,254,254,255,255,255,
+    255,
+};
+
+static int16_t sinDegrees(uint16_t angle)
+{
+    angle %= 360;
+    if(angle <= 90)
+    {
+        return sinTable[angle];
+    }
+    if(angle <= 180)
+    {
+        return sinTable[180 - angle];
+    }
+    if(angle <= 270)
+    {
+        return -(int16_t)sinTable[angle - 180];
+    }
+    return -(int16_t)sinTable[360 - angle];
+}
+
+/* Unit vector of a clock angle: 0 points up, angles grow clockwise */
+static void angleVector(uint16_t angle, int16_t *vx, int16_t *vy)
+{
+    *vx = sinDegrees(angle);
+    *vy = -sinDegrees(angle + 90);
+}
+
+/* Screen y points down, so a positive cross product means clockwise */
+static int32_t cross(int16_t ux, int16_t uy, int16_t vx, int16_t vy)
+{
+    return (int32_t)ux * vy - (int32_t)uy * vx;
+}
+
+typedef struct
+{
+    int16_t ax, ay, bx, by;
+    uint16_t sweep;
+} arc_t;
+
+static bool inArc(const arc_t *arc, int16_t x, int16_t y)
+{
+    if(arc->sweep >= 360)
+    {
+        return true;
+    }
+    if(arc->sweep <= 180)
+    {
+        return cross(arc->ax, arc->ay, x, y) >= 0 && cross(x, y, arc->bx, arc->by) >= 0;
+    }
+    return !(cross(arc->bx, arc->by, x, y) > 0 && cross(x, y, arc->ax, arc->ay) > 0);
+}
+
+/* Emits the pixels of row span [from, to] that lie inside the arc as runs */
+static void drawArcSpan(uint8_t x0, uint8_t y0, int16_t from, int16_t to, int16_t y, const arc_t *arc, uint16_t color)
+{
+    int16_t x, runStart = 0;
+    bool inRun = false;
+    for(x = from; x <= to + 1; x++)
+    {
+        bool inside = x <= to && inArc(arc, x, y);
+        if(inside && !inRun)
+        {
+            runStart = x;
+        }
+        else if(!inside && inRun)
+        {
+            drawHSpan((int16_t)x0 + runStart, (int16_t)x0 + x - 1, (int16_t)y0 + y, color);
+        }
+        inRun = inside;
+    }
+}
 
-    while (xCurr >= yMax)
+/* Fills the annulus between the outer radius and inner radius + 1 row by row,
+ * with at most two spans per row; arc == NULL fills the full ring. Like
+ * circles, only the part within radius 95 is drawn. */
+static void fillAnnulus(uint8_t x0, uint8_t y0, int16_t outer, int16_t inner, const arc_t *arc, uint16_t color)
+{
+    uint8_t outerWidth[96], innerWidth[96];
+    int16_t y, row, hwOut, hwIn, top, bottom;
+    if(inner >= 95)
+    {
+        return;
+    }
+    outer = outer > 95 ? 95 : outer;
+    top = (int16_t)y0 - outer;
+    bottom = (int16_t)y0 + outer;
+    if(!clipRows(&top, &bottom))
+    {
+        return;
+    }
+    computeCircleSpans(outer, outerWidth);
+    if(inner >= 0)
+    {
+        computeCircleSpans(inner, innerWidth);
+    }
+    for(y = top - y0; y <= bottom - y0; y++)
     {
-        d += (2*yMax+1);
-        yMax++;
-        if(d >= 0)
+        row = y < 0 ? -y : y;
+        hwOut = outerWidth[row];
+        hwIn = (inner >= 0 && row <= inner) ? innerWidth[row] : -1;
+        if(hwIn < 0)
         {
-            for(y = y; y < yMax; y++)
+            if(arc)
             {
-                for(x = y; x < xCurr; x++)
-                {
-                    oledC_DrawPoint(x0 + x,y0 + y, color);
-                    oledC_DrawPoint(x0 + x,y0 - y, color);
-                    oledC_DrawPoint(x0 - x,y0 + y, color);
-                    oledC_DrawPoint(x0 - x,y0 - y, color);    
-                    oledC_DrawPoint(x0 + y,y0 + x, color);
-                    oledC_DrawPoint(x0 + y,y0 - x, color);
-                    oledC_DrawPoint(x0 - y,y0 + x, color);
-                    oledC_DrawPoint(x0 - y,y0 - x, color);
-                }
+                drawArcSpan(x0, y0, -hwOut, hwOut, y, arc, color);
+            }
+            else
+            {
+                drawHSpan((int16_t)x0 - hwOut, (int16_t)x0 + hwOut, (int16_t)y0 + y, color);
             }
-            d += -2*xCurr + 1;
-            xCurr--;
+            continue;
+        }
+        if(arc)
+        {
+            drawArcSpan(x0, y0, -hwOut, -hwIn - 1, y, arc, color);
+            drawArcSpan(x0, y0, hwIn + 1, hwOut, y, arc, color);
+        }
+        else
+        {
+            drawHSpan((int16_t)x0 - hwOut, (int16_t)x0 - hwIn - 1, (int16_t)y0 + y, color);
+            drawHSpan((int16_t)x0 + hwIn + 1, (int16_t)x0 + hwOut, (int16_t)y0 + y, color);
         }
     }
 }
 
 void oledC_DrawRing(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t width, uint16_t color)
 {
-    int8_t x, y;
-    int16_t d;
-    radius += width >> 1;
-    while(width-- > 0)
+    int16_t outer = (int16_t)radius + (width >> 1);
+    if(width == 0)
     {
-        x = radius;
-        y = 0;
-        d = 0;
+        return;
+    }
+    fillAnnulus(x0, y0, outer, outer - width, NULL, color);
+}
+
+void oledC_DrawArc(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t width, uint16_t start_angle, uint16_t end_angle, uint16_t color)
+{
+    arc_t arc;
+    int16_t outer = (int16_t)radius + (width >> 1);
+    if(width == 0 || start_angle == end_angle)
+    {
+        return;
+    }
+    if(end_angle > start_angle)
+    {
+        arc.sweep = end_angle - start_angle >= 360 ? 360 : end_angle - start_angle;
+    }
+    else
+    {
+        /* angles a whole turn apart (0 and 360) still sweep the full ring */
+        arc.sweep = 360 - (start_angle - end_angle) % 360;
+    }
+    angleVector(start_angle, &arc.ax, &arc.ay);
+    angleVector(end_angle, &arc.bx, &arc.by);
+    fillAnnulus(x0, y0, outer, outer - width, &arc, color);
+}
 
-        while (x >= y)
+static void drawVSpan(int16_t x, int16_t start_y, int16_t end_y, uint16_t color)
+{
+    int16_t end_x = x;
+    if(clipRect(&x, &start_y, &end_x, &end_y))
+    {
+        fillScreenRect(x, start_y, end_x, end_y, color);
+    }
+}
+
+/* 1 pixel wide line, any octant; pixels of one row (or one column for
+ * steep lines) are merged into a single windowed run */
+static void drawThinLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+    int16_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int16_t dy = y1 > y0 ? y1 - y0 : y0 - y1;
+    int16_t sx = x1 > x0 ? 1 : -1;
+    int16_t sy = y1 > y0 ? 1 : -1;
+    int16_t err = dx - dy, e2;
+    int16_t runX = x0, runY = y0, lastX = x0, lastY = y0;
+    bool steep = dy > dx;
+
+    while(x0 != x1 || y0 != y1)
+    {
+        e2 = 2 * err;
+        if(e2 > -dy)
+        {
+            err -= dy;
+            x0 += sx;
+        }
+        if(e2 < dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+        if(steep ? x0 != lastX : y0 != lastY)
         {
-            oledC_DrawPoint(x0 + x,y0 + y, color);
-            oledC_DrawPoint(x0 + x,y0 - y, color);
-            oledC_DrawPoint(x0 - x,y0 + y, color);
-            oledC_DrawPoint(x0 - x,y0 - y, color);    
-            oledC_DrawPoint(x0 + y,y0 + x, color);
-            oledC_DrawPoint(x0 + y,y0 - x, color);
-            oledC_DrawPoint(x0 - y,y0 + x, color);
-            oledC_DrawPoint(x0 - y,y0 - x, color);
-            
-            d += (2*y+1);
-            y++;
-            if(d >= 0)
+            if(steep)
+            {
+                drawVSpan(lastX, runY < lastY ? runY : lastY, runY < lastY ? lastY : runY, color);
+            }
+            else
             {
-                d += -2*x + 1;
-                x--;
+                drawHSpan(runX < lastX ? runX : lastX, runX < lastX ? lastX : runX, lastY, color);
             }
+            runX = x0;
+            runY = y0;
         }
-        radius--;
+        lastX = x0;
+        lastY = y0;
+    }
+    if(steep)
+    {
+        drawVSpan(lastX, runY < lastY ? runY : lastY, runY < lastY ? lastY : runY, color);
+    }
+    else
+    {
+        drawHSpan(runX < lastX ? runX : lastX, runX < lastX ? lastX : runX, lastY, color);
     }
 }
 
-void oledC_DrawLine(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t width, uint16_t color)
+static int16_t floorDiv16(int32_t value)
 {
-    int8_t x, y;
-    int8_t dx, dy, D;
-    width = width <= 1 ? 1 : width;
-    
-    dx = x1 - x0;
-    dy = y1 - y0;
-    D = dy - dx;
-    y = y0;
-    
-    for(x = x0; x < x1; x++)
+    return value >= 0 ? value / 16 : -((-value + 15) / 16);
+}
+
+static uint16_t squareRoot(uint32_t value)
+{
+    uint16_t root = 0, bit = 1u << 15;
+    while(bit)
     {
-        if(x <= OLED_DIM_WIDTH && y <= OLED_DIM_HEIGHT)
+        uint16_t trial = root | bit;
+        if((uint32_t)trial * trial <= value)
         {
-            if(width <= 1)
-            {
-                oledC_DrawPoint(x,y, color);
-            } 
-            else 
+            root = trial;
+        }
+        bit >>= 1;
+    }
+    return root;
+}
+
+/* Scanline fill of a convex polygon given in 1/16 pixel units; a pixel is
+ * drawn when its center lies inside */
+static void fillConvexPolygon(const int16_t *px, const int16_t *py, uint8_t corners, uint16_t color)
+{
+    int16_t yMin = py[0], yMax = py[0], y, xl, xr, top, bottom;
+    int32_t yc, x, left, right;
+    uint8_t i, j;
+    for(i = 1; i < corners; i++)
+    {
+        yMin = py[i] < yMin ? py[i] : yMin;
+        yMax = py[i] > yMax ? py[i] : yMax;
+    }
+    top = floorDiv16(yMin);
+    bottom = floorDiv16(yMax);
+    if(!clipRows(&top, &bottom))
+    {
+        return;
+    }
+    for(y = top; y <= bottom; y++)
+    {
+        yc = (int32_t)y * 16 + 8;
+        left = INT32_MAX;
+        right = INT32_MIN;
+        for(i = 0; i < corners; i++)
+        {
+            j = (i + 1) % corners;
+            if((py[i] <= yc && yc < py[j]) || (py[j] <= yc && yc < py[i]))
             {
-                oledC_DrawCircle(x, y, width/2, color);
+                x = px[i] + (yc - py[i]) * (px[j] - px[i]) / (py[j] - py[i]);
+                left = x < left ? x : left;
+                right = x > right ? x : right;
             }
         }
-        if(D >= 0)
+        if(left > right)
         {
-            y = y+1;
-            D = D - dx;
+            continue;
+        }
+        xl = -floorDiv16(-(left - 8));
+        xr = floorDiv16(right - 8);
+        if(xl <= xr)
+        {
+            drawHSpan(xl, xr, y, color);
         }
-        D = D + dy;
     }
 }
 
-void oledC_DrawRectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+void oledC_DrawLine(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t width, uint16_t color)
 {
-    uint8_t x;
-    uint8_t y;
-    oledC_setColumnAddressBounds(start_x,end_x);
-    oledC_setRowAddressBounds(start_y,end_y);
-    for(x = start_x; x < end_x+1; x++)
+    int16_t dx = (int16_t)x1 - x0;
+    int16_t dy = (int16_t)y1 - y0;
+    int16_t px[4], py[4], ox, oy;
+    uint16_t length, half;
+    uint8_t radius = width >> 1;
+
+    if(width <= 1 || radius == 0)
     {
-        for(y = start_y; y < end_y+1; y++)
+        if(dy == 0)
+        {
+            drawHSpan(dx < 0 ? x1 : x0, dx < 0 ? x0 : x1, y0, color);
+        }
+        else if(dx == 0)
+        {
+            drawVSpan(x0, dy < 0 ? y1 : y0, dy < 0 ? y0 : y1, color);
+        }
+        else
         {
-            oledC_sendColorInt(color);
+            drawThinLine(x0, y0, x1, y1, color);
         }
+        return;
+    }
+
+    /* body: the segment widened to 2 * radius + 1 pixels, as a quad */
+    length = squareRoot((int32_t)dx * dx + (int32_t)dy * dy);
+    if(length > 0)
+    {
+        half = (uint16_t)radius * 16 + 8;
+        ox = (int32_t)-dy * half / length;
+        oy = (int32_t)dx * half / length;
+        px[0] = x0 * 16 + 8 + ox;
+        py[0] = y0 * 16 + 8 + oy;
+        px[1] = x1 * 16 + 8 + ox;
+        py[1] = y1 * 16 + 8 + oy;
+        px[2] = x1 * 16 + 8 - ox;
+        py[2] = y1 * 16 + 8 - oy;
+        px[3] = x0 * 16 + 8 - ox;
+        py[3] = y0 * 16 + 8 - oy;
+        fillConvexPolygon(px, py, 4, color);
+    }
+    /* round caps */
+    oledC_DrawCircle(x0, y0, radius, color);
+    oledC_DrawCircle(x1, y1, radius, color);
+}
+
+void oledC_DrawRectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    int16_t xs = start_x, ys = start_y, xe = end_x, ye = end_y;
+    if(end_x < start_x || end_y < start_y || !clipRect(&xs, &ys, &xe, &ye))
+    {
+        return;
     }
+    fillScreenRect(xs, ys, xe, ye, color);
 }
 
 void oledC_DrawCharacter(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color)
@@ -334,116 +743,286 @@ void oledC_DrawString(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *str
     }
 }
 
-void oledC_DrawBitmap(uint8_t x, uint8_t y, uint16_t color, uint8_t sx, uint8_t sy, uint32_t *bitmap, uint8_t bitmap_length)
+/* Colour of cell column cx in cell row block b; block 0 is the blank line
+ * above the glyph and the last column is the inter-character gap */
+static uint16_t glyphPixel(const uint8_t *f, uint8_t column, uint8_t block, uint16_t fg, uint16_t bg)
 {
-    const uint8_t bitmap_width = 32;
-    uint8_t rowNum;
-    uint8_t bitNum;
+    if(column >= OLED_FONT_WIDTH || block == 0)
+    {
+        return bg;
+    }
+    return (f[column] & (0x100 >> block)) ? fg : bg;
+}
+
+static void drawGlyphCell(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t fg, uint16_t bg)
+{
+    static uint16_t columnPixels[96];
+    const uint8_t *f;
+    uint8_t width, height, cx, block, run, screenX, screenY;
+    uint16_t color;
+
+    ch = (ch < ' ' || ch > '~') ? ' ' : ch;
+    f = &font[(ch-' ')*OLED_FONT_WIDTH];
     sx = sx == 0 ? 1 : sx;
     sy = sy == 0 ? 1 : sy;
-    for(rowNum = 0; rowNum < bitmap_length; rowNum++)
+    width = OLED_FONT_WIDTH * sx + 1;
+    width = width > 0xFF - x ? 0xFF - x : width;
+    height = OLED_FONT_HEIGHT * sy;
+    height = height > 0xFF - y ? 0xFF - y : height;
+
+    if(drawTarget != OLEDC_TARGET_PANEL || !oledC_viewportWindow(x, y, width, height, &screenX, &screenY))
     {
-        uint32_t rowBits = *bitmap++;
-        uint8_t curr_y = y + rowNum*sy;
-        for(bitNum = 0; bitNum < bitmap_width; bitNum++)
+        /* off-screen targets and clipped cells: one rectangle per run of
+         * equal colour per block, clipped by oledC_DrawRectangle */
+        for(block = 0; block * sy < height; block++)
         {
-            if(!(rowBits & 0x01))
+            uint8_t top = y + block * sy;
+            uint8_t bottom = top + sy - 1 > y + height - 1 ? y + height - 1 : top + sy - 1;
+            for(cx = 0; cx < width; cx += run)
             {
-                uint8_t curr_x = x + (bitmap_width - bitNum)*sx;
-                oledC_DrawRectangle(curr_x, curr_y, curr_x+sx-1, curr_y+sy-1, color);
+                color = glyphPixel(f, cx / sx, block, fg, bg);
+                for(run = 1; cx + run < width && glyphPixel(f, (cx + run) / sx, block, fg, bg) == color; run++);
+                oledC_DrawRectangle(x + cx, top, x + cx + run - 1, bottom, color);
             }
-            rowBits >>= 0x000001;
         }
+        return;
     }
+
+    /* panel: the whole cell is one window; in vertical increment mode each
+     * font byte is one column, so it is streamed without transposing */
+    oledC_setColumnAddressBounds(screenX, screenX + width - 1);
+    oledC_setRowAddressBounds(screenY, screenY + height - 1);
+    oledC_beginWriteSession();
+    for(cx = 0; cx < width; cx += run)
+    {
+        uint8_t row;
+        run = cx / sx >= OLED_FONT_WIDTH ? 1 : sx - cx % sx;
+        run = cx + run > width ? width - cx : run;
+        for(row = 0; row < height; row++)
+        {
+            columnPixels[row] = glyphPixel(f, cx / sx, row / sy, fg, bg);
+        }
+        for(block = 0; block < run; block++)
+        {
+            oledC_sendPixels(columnPixels, height);
+        }
+    }
+    oledC_endWriteSession();
 }
 
-/* Standardized Shape Drawing */
-static void drawPoint(shape_t *shape)
+void oledC_DrawCharacterOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t fg, uint16_t bg)
 {
-    oledC_DrawPoint(
-        shape->params.point.x, 
-        shape->params.point.y,
-        shape->params.point.color
-    );
+    oledC_setVerticalIncrement(drawTarget == OLEDC_TARGET_PANEL);
+    drawGlyphCell(x, y, sx, sy, ch, fg, bg);
+    oledC_setVerticalIncrement(false);
 }
 
-static void drawCircle(shape_t *shape)
+void oledC_DrawStringOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *string, uint16_t fg, uint16_t bg)
 {
-    oledC_DrawCircle(
-        shape->params.circle.xc, 
-        shape->params.circle.yc, 
-        shape->params.circle.radius, 
-        shape->params.circle.color
-    );
+    uint16_t position = x;
+    /* the remap is switched once for the whole string */
+    oledC_setVerticalIncrement(drawTarget == OLEDC_TARGET_PANEL);
+    while(*string && position < 0xFF)
+    {
+        drawGlyphCell(position, y, sx, sy, *string++, fg, bg);
+        position += OLED_FONT_WIDTH * sx + 1;
+    }
+    oledC_setVerticalIncrement(false);
 }
 
-static void drawRing(shape_t *shape)
+/* A changed area of a glyph transition, packed as
+ * column(3) | columns(3) | block(3) | blocks(4) | foreground(1) */
+#define DIFF_SPAN(col, cols, block, blocks, fg) \
+    (((uint16_t)(col) << 13) | ((uint16_t)((cols) - 1) << 10) | ((uint16_t)(block) << 7) | ((uint16_t)((blocks) - 1) << 3) | ((fg) ? 1 : 0))
+#define DIFF_FULL_REDRAW 0xFF
+
+typedef struct
 {
-    oledC_DrawRing(
-        shape->params.ring.x0, 
-        shape->params.ring.y0, 
-        shape->params.ring.radius, 
-        shape->params.ring.width, 
-        shape->params.ring.color
-    );
+    uint8_t oldCh, newCh;
+    uint8_t count;
+    uint8_t hits;
+    uint16_t spans[OLEDC_GLYPH_DIFF_SPANS];
+} glyph_diff_t;
+
+static glyph_diff_t diffCache[OLEDC_GLYPH_DIFF_CACHE];
+
+static uint8_t glyphColumn(uint8_t ch, uint8_t column)
+{
+    ch = (ch < ' ' || ch > '~') ? ' ' : ch;
+    /* bit 0 lies below the 8 row cell and is never drawn */
+    return font[(ch-' ')*OLED_FONT_WIDTH + column] & 0xFE;
 }
 
-static void drawRectangle(shape_t *shape)
+/* Splits the pixels that differ between two glyphs into rectangles of equal
+ * new colour; neighbouring columns with the same change are merged */
+static void computeGlyphDiff(glyph_diff_t *diff)
 {
-    oledC_DrawRectangle(
-        shape->params.rectangle.xs, 
-        shape->params.rectangle.ys,
-        shape->params.rectangle.xe, 
-        shape->params.rectangle.ye, 
-        shape->params.rectangle.color
-    );
+    uint8_t col, cols, block, blocks, changed, bits;
+    diff->count = 0;
+    for(col = 0; col < OLED_FONT_WIDTH; col += cols)
+    {
+        changed = glyphColumn(diff->oldCh, col) ^ glyphColumn(diff->newCh, col);
+        bits = glyphColumn(diff->newCh, col) & changed;
+        for(cols = 1; col + cols < OLED_FONT_WIDTH; cols++)
+        {
+            uint8_t nextChanged = glyphColumn(diff->oldCh, col + cols) ^ glyphColumn(diff->newCh, col + cols);
+            if(nextChanged != changed || (glyphColumn(diff->newCh, col + cols) & nextChanged) != bits)
+            {
+                break;
+            }
+        }
+        for(block = 1; block < OLED_FONT_HEIGHT; block += blocks)
+        {
+            uint8_t mask = 0x80 >> (block - 1);
+            if(!(changed & mask))
+            {
+                blocks = 1;
+                continue;
+            }
+            for(blocks = 1; block + blocks < OLED_FONT_HEIGHT; blocks++)
+            {
+                uint8_t next = mask >> blocks;
+                if(!(changed & next) || !(bits & next) != !(bits & mask))
+                {
+                    break;
+                }
+            }
+            if(diff->count >= OLEDC_GLYPH_DIFF_SPANS)
+            {
+                diff->count = DIFF_FULL_REDRAW;
+                return;
+            }
+            diff->spans[diff->count++] = DIFF_SPAN(col, cols, block, blocks, bits & mask);
+        }
+    }
 }
 
-static void drawLine(shape_t *shape)
+static const glyph_diff_t *lookupGlyphDiff(uint8_t oldCh, uint8_t newCh)
 {
-    oledC_DrawLine(
-        shape->params.line.xs, 
-        shape->params.line.ys,
-        shape->params.line.xe, 
-        shape->params.line.ye, 
-        shape->params.line.width, 
-        shape->params.line.color
-    );
+    static glyph_diff_t scratch;
+    glyph_diff_t *victim = &diffCache[0];
+    uint8_t i;
+    for(i = 0; i < OLEDC_GLYPH_DIFF_CACHE; i++)
+    {
+        glyph_diff_t *entry = &diffCache[i];
+        if(entry->hits && entry->oldCh == oldCh && entry->newCh == newCh)
+        {
+            if(entry->hits < 0xFF)
+            {
+                entry->hits++;
+            }
+            return entry;
+        }
+        victim = entry->hits < victim->hits ? entry : victim;
+    }
+    /* learn the transition; the least used entry makes room, and every
+     * entry slowly ages so old favourites can be replaced */
+    for(i = 0; i < OLEDC_GLYPH_DIFF_CACHE; i++)
+    {
+        diffCache[i].hits -= diffCache[i].hits > 1 ? 1 : 0;
+    }
+    if(victim->hits > 1)
+    {
+        victim = &scratch;
+    }
+    victim->oldCh = oldCh;
+    victim->newCh = newCh;
+    victim->hits = 1;
+    computeGlyphDiff(victim);
+    return victim;
 }
 
-static void drawCharacter(shape_t *shape)
+void oledC_DrawCharacterDiff(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t oldCh, uint8_t newCh, uint16_t fg, uint16_t bg)
 {
-    oledC_DrawCharacter(
-        shape->params.character.x, 
-        shape->params.character.y,
-        shape->params.character.scale_x, 
-        shape->params.character.scale_y, 
-        shape->params.character.character, 
-        shape->params.character.color
-    );
+    const glyph_diff_t *diff;
+    uint8_t i;
+    if(oldCh == newCh)
+    {
+        return;
+    }
+    diff = lookupGlyphDiff(oldCh, newCh);
+    if(diff->count == DIFF_FULL_REDRAW)
+    {
+        oledC_DrawCharacterOpaque(x, y, sx, sy, newCh, fg, bg);
+        return;
+    }
+    sx = sx == 0 ? 1 : sx;
+    sy = sy == 0 ? 1 : sy;
+    for(i = 0; i < diff->count; i++)
+    {
+        uint16_t span = diff->spans[i];
+        uint8_t col = span >> 13;
+        uint8_t cols = ((span >> 10) & 0x07) + 1;
+        uint8_t block = (span >> 7) & 0x07;
+        uint8_t blocks = ((span >> 3) & 0x0F) + 1;
+        uint16_t startX = x + (uint16_t)col * sx;
+        uint16_t startY = y + (uint16_t)block * sy;
+        uint16_t endX = startX + (uint16_t)cols * sx - 1;
+        uint16_t endY = startY + (uint16_t)blocks * sy - 1;
+        if(startX > 0xFF || startY > 0xFF)
+        {
+            continue;
+        }
+        endX = endX > 0xFF ? 0xFF : endX;
+        endY = endY > 0xFF ? 0xFF : endY;
+        oledC_DrawRectangle(startX, startY, endX, endY, (span & 0x01) ? fg : bg);
+    }
 }
 
-static void drawString(shape_t *shape)
+void oledC_DrawBitmap(uint8_t x, uint8_t y, uint16_t color, uint8_t sx, uint8_t sy, uint32_t *bitmap, uint8_t bitmap_length)
 {
-    oledC_DrawString(
-        shape->params.string.x, 
-        shape->params.string.y,
-        shape->params.string.scale_x, 
-        shape->params.string.scale_y, 
-        shape->params.string.string, 
-        shape->params.string.color
-    );
+    const uint8_t bitmap_width = 32;
+    uint8_t rowNum;
+    uint8_t bitNum;
+    sx = sx == 0 ? 1 : sx;
+    sy = sy == 0 ? 1 : sy;
+    for(rowNum = 0; rowNum < bitmap_length; rowNum++)
+    {
+        uint32_t rowBits = *bitmap++;
+        uint8_t curr_y = y + rowNum*sy;
+        for(bitNum = 0; bitNum < bitmap_width; bitNum++)
+        {
+            if(!(rowBits & 0x01))
+            {
+                uint8_t curr_x = x + (bitmap_width - bitNum)*sx;
+                oledC_DrawRectangle(curr_x, curr_y, curr_x+sx-1, curr_y+sy-1, color);
+            }
+            rowBits >>= 0x000001;
+        }
+    }
 }
 
-static void drawBitmap(shape_t *shape)
+/* Standardized Shape Drawing */
+void oledC_drawShape(enum OLEDC_SHAPE shape_type, const shape_params_t *params)
 {
-    oledC_DrawBitmap(
-        shape->params.bitmap.x, 
-        shape->params.bitmap.y,
-        shape->params.bitmap.color,
-        shape->params.bitmap.sx,
-        shape->params.bitmap.sy,
-        shape->params.bitmap.bit_array,
-        shape->params.bitmap.array_length
-    );
+    switch(shape_type)
+    {
+        case OLED_SHAPE_CIRCLE:
+            oledC_DrawCircle(params->circle.xc, params->circle.yc, params->circle.radius, params->circle.color);
+            break;
+        case OLED_SHAPE_RING:
+            oledC_DrawRing(params->ring.x0, params->ring.y0, params->ring.radius, params->ring.width, params->ring.color);
+            break;
+        case OLED_SHAPE_RECTANGLE:
+            oledC_DrawRectangle(params->rectangle.xs, params->rectangle.ys, params->rectangle.xe, params->rectangle.ye, params->rectangle.color);
+            break;
+        case OLED_SHAPE_LINE:
+            oledC_DrawLine(params->line.xs, params->line.ys, params->line.xe, params->line.ye, params->line.width, params->line.color);
+            break;
+        case OLED_SHAPE_CHARACTER:
+            oledC_DrawCharacter(params->character.x, params->character.y, params->character.scale_x,
+                params->character.scale_y, params->character.character, params->character.color);
+            break;
+        case OLED_SHAPE_STRING:
+            oledC_DrawString(params->string.x, params->string.y, params->string.scale_x,
+                params->string.scale_y, params->string.string, params->string.color);
+            break;
+        case OLED_SHAPE_BITMAP:
+            oledC_DrawBitmap(params->bitmap.x, params->bitmap.y, params->bitmap.color, params->bitmap.sx,
+                params->bitmap.sy, params->bitmap.bit_array, params->bitmap.array_length);
+            break;
+        default:
+            oledC_DrawPoint(params->point.x, params->point.y, params->point.color);
+            break;
+    }
 }
@@ -26,6 +26,26 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+/* Circles up to this radius keep their row spans cached (at most 47, which
+ * takes 1176 bytes of RAM; the default 8 takes 45) */
+#ifndef OLEDC_CIRCLE_CACHE_RADIUS
+#define OLEDC_CIRCLE_CACHE_RADIUS 8
+#endif
+
+/* Nested viewports/clip rectangles on top of the full screen */
+#ifndef OLEDC_VIEWPORT_DEPTH
+#define OLEDC_VIEWPORT_DEPTH 4
+#endif
+
+/* Learned glyph transitions (e.g. the ten seconds digit steps) and the
+ * rectangles each one may keep before it falls back to a full redraw */
+#ifndef OLEDC_GLYPH_DIFF_CACHE
+#define OLEDC_GLYPH_DIFF_CACHE 10
+#endif
+#ifndef OLEDC_GLYPH_DIFF_SPANS
+#define OLEDC_GLYPH_DIFF_SPANS 12
+#endif
+
 enum OLEDC_SHAPE 
 {
     OLED_SHAPE_CIRCLE,
@@ -38,6 +58,13 @@ enum OLEDC_SHAPE
     OLED_SHAPE_BITMAP,
 };
 
+enum OLEDC_DRAW_TARGET
+{
+    OLEDC_TARGET_PANEL,
+    OLEDC_TARGET_FRAMEBUFFER,
+    OLEDC_TARGET_BAND,
+};
+
 typedef union shape_params_t 
 {
     struct 
@@ -108,18 +135,39 @@ typedef union shape_params_t
     } bitmap;
 } shape_params_t;
 
-typedef struct shape 
-{
-    uint8_t _type;
-    void (*draw)(struct shape*);
-    shape_params_t params;
-    bool active;
-} shape_t;
+void oledC_setDrawTarget(enum OLEDC_DRAW_TARGET target);
+enum OLEDC_DRAW_TARGET oledC_getDrawTarget(void);
+
+/* Viewports: pushViewport() moves the origin to (x, y) and clips to the
+ * width x height area, pushClip() only clips. Both take coordinates of the
+ * current viewport, nest by intersection and return false when the stack is
+ * full. Every primitive draws in local coordinates and is clipped once per
+ * span, so widgets can draw relative to themselves and redraws can be
+ * limited to a damaged rectangle. */
+bool oledC_pushViewport(int16_t x, int16_t y, uint8_t width, uint8_t height);
+bool oledC_pushClip(int16_t x, int16_t y, uint8_t width, uint8_t height);
+/* Clip to a screen area with the origin back at the screen corner, whatever
+ * the current viewport; for renderers that cover the whole screen */
+bool oledC_pushScreenClip(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+void oledC_popViewport(void);
+void oledC_resetViewport(void);
+/* Current clip rectangle in local coordinates (empty when end < start) */
+void oledC_getClip(int16_t *start_x, int16_t *start_y, int16_t *end_x, int16_t *end_y);
+/* For streaming writers: true if the local area is fully visible, which
+ * then yields its screen position for the address window */
+bool oledC_viewportWindow(int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t *screen_x, uint8_t *screen_y);
 
-void oledC_createShape(enum OLEDC_SHAPE shape_type, shape_params_t *params, shape_t *newShape);
+/* Draw a shape described by its type tag and params */
+void oledC_drawShape(enum OLEDC_SHAPE shape_type, const shape_params_t *params);
 
 void oledC_DrawCircle(uint8_t center_x, uint8_t center_y, uint8_t radius, uint16_t color);
 void oledC_DrawRing(uint8_t center_x, uint8_t center_y, uint8_t radius, uint8_t width, uint16_t color);
+/* Part of a ring from start_angle to end_angle in degrees, clockwise with 0
+ * at 12 o'clock. Equal angles draw nothing; angles that differ by a whole
+ * number of turns (e.g. 0 and 360) draw the full ring. Progress rings only
+ * need to draw the delta between the previous and the new angle (or erase
+ * it when the value went down). */
+void oledC_DrawArc(uint8_t center_x, uint8_t center_y, uint8_t radius, uint8_t width, uint16_t start_angle, uint16_t end_angle, uint16_t color);
 void oledC_DrawRectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
 void oledC_DrawLine(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t width, uint16_t color);
 void oledC_DrawPoint(uint8_t x, uint8_t y, uint16_t color);
@@ -127,6 +175,12 @@ uint16_t oledC_ReadPoint(uint8_t x, uint8_t y);
 void oledC_DrawThickPoint(uint8_t center_x, uint8_t center_y, uint8_t width, uint16_t color);
 void oledC_DrawCharacter(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color);
 void oledC_DrawString(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *string, uint16_t color);
+/* Opaque glyphs: the whole cell, including the gap column, is written once
+ * in fg/bg, so no clearing pass is needed */
+void oledC_DrawCharacterOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t fg, uint16_t bg);
+void oledC_DrawStringOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *string, uint16_t fg, uint16_t bg);
+/* Turns an opaque oldCh cell into newCh by drawing only the pixels that differ */
+void oledC_DrawCharacterDiff(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t oldCh, uint8_t newCh, uint16_t fg, uint16_t bg);
 void oledC_DrawBitmap(uint8_t x, uint8_t y, uint16_t color, uint8_t sx, uint8_t sy, uint32_t *bit_array, uint8_t array_width);
 
 #endif	/* OLEDC_SHAPES_H */
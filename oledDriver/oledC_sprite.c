@@ -0,0 +1,113 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oledC_sprite.h"
+#include "oledC_shapes.h"
+#include "oledC.h"
+
+static uint8_t spritePixel(const uint8_t *row, uint8_t column)
+{
+    uint8_t packed = row[column >> 1];
+    return (column & 0x01) ? (packed & 0x0F) : (packed >> 4);
+}
+
+/* Draws the opaque run [start, end] of one sprite row, one colour piece at a time */
+static void drawRun(const oledC_atlas_t *atlas, const uint8_t *row, int16_t x, int16_t y, uint8_t start, uint8_t end)
+{
+    uint8_t column = start, piece, index, windowX, windowY;
+    bool panel = oledC_getDrawTarget() == OLEDC_TARGET_PANEL &&
+        oledC_viewportWindow(x + start, y, end - start + 1, 1, &windowX, &windowY);
+    if(panel)
+    {
+        oledC_setColumnAddressBounds(windowX, windowX + end - start);
+        oledC_setRowAddressBounds(windowY, windowY);
+        oledC_beginWriteSession();
+    }
+    while(column <= end)
+    {
+        index = spritePixel(row, column);
+        for(piece = 1; column + piece <= end && spritePixel(row, column + piece) == index; piece++);
+        if(panel)
+        {
+            oledC_sendColorRun(atlas->palette[index], piece);
+        }
+        else
+        {
+            oledC_DrawRectangle(x + column, y, x + column + piece - 1, y, atlas->palette[index]);
+        }
+        column += piece;
+    }
+    if(panel)
+    {
+        oledC_endWriteSession();
+    }
+}
+
+void oledC_DrawSprite(int16_t x, int16_t y, const oledC_atlas_t *atlas, uint8_t index)
+{
+    const oledC_spriteInfo_t *sprite;
+    const uint8_t *row;
+    int16_t clipXs, clipYs, clipXe, clipYe;
+    uint8_t rowBytes, firstColumn, lastColumn, firstRow, lastRow, r, column, start;
+
+    if(index >= atlas->count)
+    {
+        return;
+    }
+    sprite = &atlas->sprites[index];
+    /* clip once against the current viewport, in local coordinates */
+    oledC_getClip(&clipXs, &clipYs, &clipXe, &clipYe);
+    clipXe = clipXe > 0xFF ? 0xFF : clipXe;
+    clipYe = clipYe > 0xFF ? 0xFF : clipYe;
+    if(x > clipXe || y > clipYe || x + sprite->width <= clipXs || y + sprite->height <= clipYs)
+    {
+        return;
+    }
+    firstColumn = x < clipXs ? clipXs - x : 0;
+    lastColumn = x + sprite->width - 1 > clipXe ? clipXe - x : sprite->width - 1;
+    firstRow = y < clipYs ? clipYs - y : 0;
+    lastRow = y + sprite->height - 1 > clipYe ? clipYe - y : sprite->height - 1;
+    rowBytes = (sprite->width + 1) >> 1;
+
+    for(r = firstRow; r <= lastRow; r++)
+    {
+        row = &atlas->pixels[sprite->offset + (uint16_t)r * rowBytes];
+        column = firstColumn;
+        while(column <= lastColumn)
+        {
+            if(spritePixel(row, column) == atlas->transparent)
+            {
+                column++;
+                continue;
+            }
+            start = column;
+            while(column < lastColumn && spritePixel(row, column + 1) != atlas->transparent)
+            {
+                column++;
+            }
+            drawRun(atlas, row, x, y + r, start, column);
+            column++;
+        }
+    }
+}
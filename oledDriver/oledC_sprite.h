@@ -0,0 +1,55 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef OLEDC_SPRITE_H
+#define	OLEDC_SPRITE_H
+
+#include <stdint.h>
+
+/* Sprite atlas built by tools/atlasc.py. Every sprite is stored as 4-bit
+ * palette indices, two pixels per byte with the left pixel in the high
+ * nibble and each row padded to whole bytes. The const tables stay in
+ * program memory and are read through PSV. oledC_atlasData.c holds the
+ * icons of tools/sprites/, given in name order to
+ *   python3 tools/atlasc.py watch oledDriver/oledC_atlasData <icons> */
+typedef struct
+{
+    uint8_t width;
+    uint8_t height;
+    uint16_t offset;    /* first byte of the sprite in pixels[] */
+} oledC_spriteInfo_t;
+
+typedef struct
+{
+    uint8_t count;
+    uint8_t transparent;    /* palette index that is not drawn, 0xFF for none */
+    const uint16_t *palette;
+    const oledC_spriteInfo_t *sprites;
+    const uint8_t *pixels;
+} oledC_atlas_t;
+
+/* Draws sprite index of the atlas with its top left corner at (x, y), which
+ * may lie off screen. Each row is split into opaque runs and every run gets
+ * its own window, so transparent pixels are never written. */
+void oledC_DrawSprite(int16_t x, int16_t y, const oledC_atlas_t *atlas, uint8_t index);
+
+#endif	/* OLEDC_SPRITE_H */
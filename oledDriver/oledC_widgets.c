@@ -0,0 +1,381 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "oledC_widgets.h"
+#include "oledC_shapeHandler.h"
+#include "oledC_shapes.h"
+#include "oledC_framebuffer.h"
+
+#define CHAR_ADVANCE(scale) (5 * (scale) + 1)
+
+static void render(oledC_widget_t *w);
+
+/* a as decoded by oledC_getShapeParams() against the requested b, payloads
+ * compared by value and b's colour as the palette would store it */
+static bool sameParams(enum OLEDC_SHAPE shape_type, shape_params_t a, shape_params_t b)
+{
+    b.point.color = oledC_shapeStoredColor(b.point.color);
+    if(shape_type == OLED_SHAPE_STRING)
+    {
+        if(strcmp((const char*)a.string.string, (const char*)b.string.string))
+        {
+            return false;
+        }
+        a.string.string = b.string.string = NULL;
+    }
+    else if(shape_type == OLED_SHAPE_BITMAP)
+    {
+        if(a.bitmap.array_length != b.bitmap.array_length ||
+            memcmp(a.bitmap.bit_array, b.bitmap.bit_array, (uint16_t)a.bitmap.array_length * 4))
+        {
+            return false;
+        }
+        a.bitmap.bit_array = b.bitmap.bit_array = NULL;
+    }
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+/* Create the shape or rewrite it when params differ from what it holds.
+ * params must be zeroed before filling so the comparison sees no junk. */
+static bool syncShape(oledC_shapeHandle_t *handle, enum OLEDC_SHAPE shape_type, const shape_params_t *params)
+{
+    enum OLEDC_SHAPE current_type;
+    shape_params_t current;
+    if(*handle == OLEDC_SHAPE_NONE)
+    {
+        *handle = oledC_insertShape(shape_type, params, OLEDC_SHAPE_NONE);
+        return *handle != OLEDC_SHAPE_NONE;
+    }
+    oledC_getShapeParams(*handle, &current_type, &current);
+    if(sameParams(shape_type, current, *params))
+    {
+        return true;
+    }
+    return oledC_updateShape(*handle, params);
+}
+
+static uint8_t textWidth(const char *text, uint8_t scale)
+{
+    uint16_t length = strlen(text);
+    return length ? length * CHAR_ADVANCE(scale) - 1 : 0;
+}
+
+static bool syncText(oledC_widget_t *w, const char *text)
+{
+    shape_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.string.color = w->color;
+    params.string.x = w->x;
+    params.string.y = w->y;
+    params.string.scale_x = w->scale;
+    params.string.scale_y = w->scale;
+    params.string.string = (uint8_t*)text;
+    w->width = textWidth(text, w->scale);
+    w->height = 8 * w->scale;
+    return syncShape(&w->shapes[0], OLED_SHAPE_STRING, &params);
+}
+
+/* Current text of a label; points into the shape arena */
+static const char *labelText(oledC_widget_t *w)
+{
+    enum OLEDC_SHAPE shape_type;
+    shape_params_t params;
+    if(!oledC_getShapeParams(w->shapes[0], &shape_type, &params))
+    {
+        return "";
+    }
+    return (const char*)params.string.string;
+}
+
+static bool renderCounter(oledC_widget_t *w)
+{
+    char text[6];
+    uint16_t value = w->value;
+    uint8_t length = 0, i;
+    char c;
+    do
+    {
+        text[length++] = '0' + value % 10;
+        value /= 10;
+    } while(value || (length < w->digits && length < sizeof(text) - 1));
+    text[length] = '\0';
+    for(i = 0; i < length / 2; i++)
+    {
+        c = text[i];
+        text[i] = text[length - 1 - i];
+        text[length - 1 - i] = c;
+    }
+    return syncText(w, text);
+}
+
+static bool renderBar(oledC_widget_t *w)
+{
+    shape_params_t params;
+    uint8_t fill = w->max ? (uint32_t)w->width * (w->value < w->max ? w->value : w->max) / w->max : 0;
+    bool ok;
+    memset(&params, 0, sizeof(params));
+    params.rectangle.color = w->background;
+    params.rectangle.xs = w->x;
+    params.rectangle.ys = w->y;
+    params.rectangle.xe = w->x + w->width - 1;
+    params.rectangle.ye = w->y + w->height - 1;
+    ok = syncShape(&w->shapes[0], OLED_SHAPE_RECTANGLE, &params);
+    if(ok && fill == 0 && w->shapes[1] != OLEDC_SHAPE_NONE)
+    {
+        /* an empty bar hides the fill and leaves its params alone */
+        oledC_setShapeVisible(w->shapes[1], false);
+        return true;
+    }
+    /* the fill sits above the track, so a new value only damages the
+     * columns between the old and new fill ends */
+    params.rectangle.color = w->color;
+    params.rectangle.xe = w->x + (fill ? fill - 1 : 0);
+    ok = ok && syncShape(&w->shapes[1], OLED_SHAPE_RECTANGLE, &params);
+    if(ok)
+    {
+        oledC_setShapeVisible(w->shapes[1], fill > 0);
+    }
+    return ok;
+}
+
+/* Place the children one after another and take their extent */
+static void layout(oledC_widget_t *w)
+{
+    oledC_widget_t *child;
+    uint8_t x = w->x, y = w->y;
+    w->width = w->height = 0;
+    for(child = w->child; child; child = child->next)
+    {
+        child->x = x;
+        child->y = y;
+        render(child);
+        if(w->layout == OLEDC_UI_ROW)
+        {
+            x += child->width + w->spacing;
+            w->width = x - w->x - w->spacing;
+            w->height = child->height > w->height ? child->height : w->height;
+        }
+        else
+        {
+            y += child->height + w->spacing;
+            w->height = y - w->y - w->spacing;
+            w->width = child->width > w->width ? child->width : w->width;
+        }
+    }
+}
+
+/* Bring the shapes of w in line with its state */
+static void render(oledC_widget_t *w)
+{
+    enum OLEDC_SHAPE shape_type;
+    shape_params_t params;
+    switch(w->kind)
+    {
+        case OLEDC_UI_CONTAINER:
+            layout(w);
+            break;
+        case OLEDC_UI_LABEL:
+            syncText(w, labelText(w));
+            break;
+        case OLEDC_UI_COUNTER:
+            renderCounter(w);
+            break;
+        case OLEDC_UI_BAR:
+            renderBar(w);
+            break;
+        case OLEDC_UI_ICON:
+            if(oledC_getShapeParams(w->shapes[0], &shape_type, &params))
+            {
+                params.bitmap.color = w->color;
+                params.bitmap.x = w->x;
+                params.bitmap.y = w->y;
+                syncShape(&w->shapes[0], OLED_SHAPE_BITMAP, &params);
+            }
+            break;
+    }
+}
+
+/* Re-run the layouts above w while its size keeps changing theirs */
+static void resized(oledC_widget_t *w)
+{
+    uint8_t width, height;
+    for(w = w->parent; w; w = w->parent)
+    {
+        width = w->width;
+        height = w->height;
+        layout(w);
+        if(w->width == width && w->height == height)
+        {
+            break;
+        }
+    }
+}
+
+static void attach(oledC_widget_t *w, oledC_widget_t *parent, uint8_t kind, uint8_t x, uint8_t y)
+{
+    oledC_widget_t **link;
+    memset(w, 0, sizeof(*w));
+    w->kind = kind;
+    w->x = x;
+    w->y = y;
+    w->shapes[0] = w->shapes[1] = OLEDC_SHAPE_NONE;
+    w->parent = parent;
+    if(parent)
+    {
+        for(link = &parent->child; *link; link = &(*link)->next)
+        {
+        }
+        *link = w;
+    }
+}
+
+void oledC_uiInit(uint16_t background)
+{
+    oledC_setBackground(background);
+}
+
+void oledC_uiContainer(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, enum OLEDC_UI_LAYOUT layout, uint8_t spacing)
+{
+    attach(w, parent, OLEDC_UI_CONTAINER, x, y);
+    w->layout = layout;
+    w->spacing = spacing;
+    resized(w);
+}
+
+bool oledC_uiLabel(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, uint8_t scale, const char *text, uint16_t color)
+{
+    attach(w, parent, OLEDC_UI_LABEL, x, y);
+    w->scale = scale;
+    w->color = color;
+    if(!syncText(w, text))
+    {
+        return false;
+    }
+    resized(w);
+    return true;
+}
+
+bool oledC_uiCounter(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, uint8_t scale, uint8_t digits, uint16_t color)
+{
+    attach(w, parent, OLEDC_UI_COUNTER, x, y);
+    w->scale = scale;
+    w->digits = digits;
+    w->color = color;
+    if(!renderCounter(w))
+    {
+        return false;
+    }
+    resized(w);
+    return true;
+}
+
+bool oledC_uiBar(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint16_t max, uint16_t color, uint16_t background)
+{
+    attach(w, parent, OLEDC_UI_BAR, x, y);
+    w->width = width;
+    w->height = height;
+    w->max = max;
+    w->color = color;
+    w->background = background;
+    if(!renderBar(w))
+    {
+        return false;
+    }
+    resized(w);
+    return true;
+}
+
+bool oledC_uiIcon(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, uint8_t scale, const uint32_t *rows, uint8_t count, uint16_t color)
+{
+    shape_params_t params;
+    attach(w, parent, OLEDC_UI_ICON, x, y);
+    w->scale = scale;
+    w->color = color;
+    w->width = 33 * scale;
+    w->height = count * scale;
+    memset(&params, 0, sizeof(params));
+    params.bitmap.color = color;
+    params.bitmap.x = x;
+    params.bitmap.y = y;
+    params.bitmap.sx = scale;
+    params.bitmap.sy = scale;
+    params.bitmap.bit_array = (uint32_t*)rows;
+    params.bitmap.array_length = count;
+    if(!syncShape(&w->shapes[0], OLED_SHAPE_BITMAP, &params))
+    {
+        return false;
+    }
+    resized(w);
+    return true;
+}
+
+bool oledC_uiSetText(oledC_widget_t *w, const char *text)
+{
+    uint8_t width = w->width;
+    if(w->kind != OLEDC_UI_LABEL || !syncText(w, text))
+    {
+        return false;
+    }
+    if(w->width != width)
+    {
+        resized(w);
+    }
+    return true;
+}
+
+void oledC_uiSetValue(oledC_widget_t *w, uint16_t value)
+{
+    uint8_t width = w->width;
+    if(w->value == value || (w->kind != OLEDC_UI_COUNTER && w->kind != OLEDC_UI_BAR))
+    {
+        return;
+    }
+    w->value = value;
+    render(w);
+    if(w->width != width)
+    {
+        resized(w);
+    }
+}
+
+void oledC_uiSetColor(oledC_widget_t *w, uint16_t color)
+{
+    if(w->color != color)
+    {
+        w->color = color;
+        render(w);
+    }
+}
+
+void oledC_uiFlush(void)
+{
+    oledC_composite();
+#if OLEDC_USE_FRAMEBUFFER
+    if(oledC_getDrawTarget() == OLEDC_TARGET_FRAMEBUFFER)
+    {
+        oledC_fbFlush();
+    }
+#endif
+}
@@ -0,0 +1,89 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef OLEDC_WIDGETS_H
+#define	OLEDC_WIDGETS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oledC_shapeHandler.h"
+
+/* Retained widgets on top of the shape scene. Each widget owns one or two
+ * shapes; a setter rewrites them only when the rendered result changes,
+ * which damages just that widget's area, and oledC_uiFlush() composites
+ * the damage once per frame. Widget structs are caller storage and must
+ * outlive the UI. Widgets added to a container are placed by its layout
+ * and their x and y arguments are ignored. */
+enum OLEDC_UI_KIND
+{
+    OLEDC_UI_CONTAINER,
+    OLEDC_UI_LABEL,
+    OLEDC_UI_COUNTER,
+    OLEDC_UI_BAR,
+    OLEDC_UI_ICON,
+};
+
+enum OLEDC_UI_LAYOUT
+{
+    OLEDC_UI_ROW,
+    OLEDC_UI_COLUMN,
+};
+
+typedef struct oledC_widget_t
+{
+    uint8_t kind;
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;
+    uint8_t height;
+    uint8_t scale;
+    uint8_t digits;     /* counter: minimum digits, zero padded */
+    uint8_t layout;     /* container */
+    uint8_t spacing;    /* container */
+    uint16_t color;
+    uint16_t background;    /* bar track */
+    uint16_t value;     /* counter and bar */
+    uint16_t max;       /* bar */
+    oledC_shapeHandle_t shapes[2];
+    struct oledC_widget_t *parent;
+    struct oledC_widget_t *child;
+    struct oledC_widget_t *next;
+} oledC_widget_t;
+
+void oledC_uiInit(uint16_t background);
+void oledC_uiContainer(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, enum OLEDC_UI_LAYOUT layout, uint8_t spacing);
+/* The creators return false when the shape pool or arena is full */
+bool oledC_uiLabel(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, uint8_t scale, const char *text, uint16_t color);
+bool oledC_uiCounter(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, uint8_t scale, uint8_t digits, uint16_t color);
+bool oledC_uiBar(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint16_t max, uint16_t color, uint16_t background);
+/* rows are 32-bit bitmap rows as taken by oledC_DrawBitmap() */
+bool oledC_uiIcon(oledC_widget_t *w, oledC_widget_t *parent, uint8_t x, uint8_t y, uint8_t scale, const uint32_t *rows, uint8_t count, uint16_t color);
+
+bool oledC_uiSetText(oledC_widget_t *w, const char *text);
+void oledC_uiSetValue(oledC_widget_t *w, uint16_t value);
+void oledC_uiSetColor(oledC_widget_t *w, uint16_t color);
+
+/* Repaint whatever changed since the last flush; with the framebuffer as
+ * draw target the changed pixels are pushed to the panel as well */
+void oledC_uiFlush(void);
+
+#endif	/* OLEDC_WIDGETS_H */
@@ -24,32 +24,49 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <xc.h>
-#include "../system/system.h"
-#include "../system/clock.h"
+#include "../System/system.h"
+#include "../System/clock.h"
 #include "spi1_driver.h"
 
 void (*spi1_interruptHandler)(void); 
 
+/* DMA trigger source for the SPI1 transmit event (DMAINTn.CHSEL) */
+#define SPI1_DMA_TRIGGER_TX   0x0B
+/* data RAM limits of the PIC24FJ256GA705 for DMAL/DMAH */
+#define SPI1_DMA_RAM_START    0x0800
+#define SPI1_DMA_RAM_END      0x47FF
+/* data space address of a DMA operand, the host tests supply their own */
+#ifndef SPI1_DMA_ADDRESS
+#define SPI1_DMA_ADDRESS(p)   ((uint16_t)(p))
+#endif
+
+static volatile bool dmaActive = false;
+static uint16_t dmaFillWord;
+
 void spi1_close(void)
 {
     SPI1CON1Lbits.SPIEN = 0;
 }
 
-//con == SPIxCONL, brg == SPIxBRGL, operation == Master/Slave
-typedef struct { uint16_t con1; uint16_t brg; uint8_t operation;} spi1_configuration_t;
+//con == SPIxCON1L, conh == SPIxCON1H, brg == SPIxBRGL, operation == Master/Slave
+typedef struct { uint16_t con1; uint16_t con1h; uint16_t brg; uint8_t operation;} spi1_configuration_t;
 static const spi1_configuration_t spi1_configuration[] = {   
-    { 0x0120, 0x0000, 0 },
-    { 0x0120, 0x000F, 0 }
+    { 0x0120, 0x0000, 0x0000, 0 },  /* SPI1_DEFAULT */
+    { 0x0120, 0x0000, 0x000F, 0 },  /* SPI1_SLOW */
+    { 0x0520, 0x2000, 0x0000, 0 },  /* SPI1_WORD: MODE16, IGNROV */
+    { 0x0521, 0x2000, 0x0000, 0 }   /* SPI1_WORD_FIFO: MODE16, ENHBUF, IGNROV */
 };
 
-bool spi1_open(/*spi1_modes spiUniqueConfiguration*/)
+bool spi1_open(spi1_modes spiUniqueConfiguration)
 {
+    spi1_dmaWait();
     if(!SPI1CON1Lbits.SPIEN)
     {
-        SPI1CON1L = 0x0120;//spi1_configuration[spiUniqueConfiguration].con1;
-        SPI1BRGL = 0;//spi1_configuration[spiUniqueConfiguration].brg;
+        SPI1CON1L = spi1_configuration[spiUniqueConfiguration].con1;
+        SPI1CON1H = spi1_configuration[spiUniqueConfiguration].con1h;
+        SPI1BRGL = spi1_configuration[spiUniqueConfiguration].brg;
         
-        TRISBbits.TRISB15 = 0;//spi1_configuration[spiUniqueConfiguration].operation;
+        TRISBbits.TRISB15 = spi1_configuration[spiUniqueConfiguration].operation;
         SPI1CON1Lbits.SPIEN = 1;
         return true;
     }
@@ -93,6 +110,35 @@ void spi1_readBlock(void *block, size_t blockSize)
     }
 }
 
+static void spi1_drain(void)
+{
+    while(!SPI1STATLbits.SPITBE || !SPI1STATLbits.SRMT);
+    while(!SPI1STATLbits.SPIRBE)
+    {
+        (void)SPI1BUFL;
+    }
+}
+
+void spi1_writeWords(const uint16_t *words, size_t count)
+{
+    while(count--)
+    {
+        while(SPI1STATLbits.SPITBF);
+        SPI1BUFL = *words++;
+    }
+    spi1_drain();
+}
+
+void spi1_writeWordRepeat(uint16_t word, size_t count)
+{
+    while(count--)
+    {
+        while(SPI1STATLbits.SPITBF);
+        SPI1BUFL = word;
+    }
+    spi1_drain();
+}
+
 void spi1_writeByte(uint8_t byte)
 {
     SPI1BUFL = byte;
@@ -122,3 +168,102 @@ void spi1_setSpiISR(void(*handler)(void))
     spi1_interruptHandler = handler;
 }
 
+void (*spi1_getSpiISR(void))(void)
+{
+    return spi1_interruptHandler;
+}
+
+static bool spi1_dmaStart(const uint16_t *source, uint16_t count, bool incrementSource)
+{
+    if(dmaActive || count == 0)
+    {
+        return false;
+    }
+    spi1_close();
+    spi1_open(SPI1_WORD);
+
+    DMACONbits.DMAEN = 1;
+    DMAL = SPI1_DMA_RAM_START;
+    DMAH = SPI1_DMA_RAM_END;
+    DMACH0 = 0;
+    DMACH0bits.SIZE = 0;      /* word transfers */
+    DMACH0bits.TRMODE = 0;    /* one-shot */
+    DMACH0bits.SAMODE = incrementSource ? 1 : 0;
+    DMACH0bits.DAMODE = 0;    /* SPI1BUFL stays fixed */
+    DMAINT0 = 0;
+    DMAINT0bits.CHSEL = SPI1_DMA_TRIGGER_TX;
+    DMASRC0 = SPI1_DMA_ADDRESS(source);
+    DMADST0 = SPI1_DMA_ADDRESS(&SPI1BUFL);
+    DMACNT0 = count;
+
+    dmaActive = true;
+    IFS0bits.DMA0IF = 0;
+    IEC0bits.DMA0IE = 1;
+    DMACH0bits.CHEN = 1;
+    DMACH0bits.CHREQ = 1; /* first word by software, the rest follow SPI1 TX */
+    return true;
+}
+
+/* const data in the PSV window or beyond DMAH is out of reach of the channel */
+bool spi1_dmaCanRead(const void *source, uint16_t count)
+{
+    uint32_t start = SPI1_DMA_ADDRESS(source);
+    return start >= SPI1_DMA_RAM_START && start + 2UL * count <= SPI1_DMA_RAM_END + 1UL;
+}
+
+bool spi1_dmaWriteWords(const uint16_t *words, uint16_t count)
+{
+    if(!spi1_dmaCanRead(words, count))
+    {
+        return false;
+    }
+    return spi1_dmaStart(words, count, true);
+}
+
+bool spi1_dmaFillWords(uint16_t word, uint16_t count)
+{
+    if(dmaActive)
+    {
+        return false;
+    }
+    dmaFillWord = word;
+    return spi1_dmaStart(&dmaFillWord, count, false);
+}
+
+bool spi1_dmaBusy(void)
+{
+    IEC0bits.DMA0IE = 0; /* keep _DMA0Interrupt from completing the same transfer twice */
+    spi1_dmaIsr();
+    IEC0bits.DMA0IE = dmaActive;
+    return dmaActive;
+}
+
+void spi1_dmaWait(void)
+{
+    while(spi1_dmaBusy());
+}
+
+/**
+ * DMA channel 0 done: drain the shifter, release SPI1 and notify the owner.
+ * Safe to poll, so callers blocked in spi1_dmaWait do not depend on the interrupt priority.
+ */
+void spi1_dmaIsr(void)
+{
+    if(dmaActive && IFS0bits.DMA0IF == 1)
+    {
+        IFS0bits.DMA0IF = 0;
+        DMAINT0bits.DONEIF = 0;
+        DMACH0bits.CHEN = 0;
+        while(!SPI1STATLbits.SPITBE || !SPI1STATLbits.SRMT);
+        spi1_close();
+        dmaActive = false;
+        if(spi1_interruptHandler){
+            spi1_interruptHandler();
+        }
+    }
+}
+
+void __attribute__((__interrupt__, auto_psv)) _DMA0Interrupt(void)
+{
+    spi1_dmaIsr();
+}
@@ -30,10 +30,17 @@
 
 #define INLINE  inline 
 
+typedef enum {
+    SPI1_DEFAULT,       /* 8-bit, standard buffer */
+    SPI1_SLOW,          /* 8-bit, SCK / 32 */
+    SPI1_WORD,          /* 16-bit, standard buffer, RX overflow ignored (DMA) */
+    SPI1_WORD_FIFO      /* 16-bit, enhanced buffer, RX overflow ignored */
+} spi1_modes;
+
 /* arbitration interface */
 void spi1_close(void);
 
-bool spi1_open(/*spi1_modes spiUniqueConfiguration*/);
+bool spi1_open(spi1_modes spiUniqueConfiguration);
 /* SPI native data exchange function */
 uint8_t spi1_exchangeByte(uint8_t b);
 /* SPI Block move functions }(future DMA support will be here) */
@@ -41,10 +48,26 @@ void spi1_exchangeBlock(void *block, size_t blockSize);
 void spi1_writeBlock(void *block, size_t blockSize);
 void spi1_readBlock(void *block, size_t blockSize);
 
+/* Write-only word functions for SPI1_WORD_FIFO: only wait for TX FIFO space,
+ * then drain the shifter and drop whatever was received */
+void spi1_writeWords(const uint16_t *words, size_t count);
+void spi1_writeWordRepeat(uint16_t word, size_t count);
+
 void spi1_writeByte(uint8_t byte);
 uint8_t spi1_readByte(void);
 
 void spi1_isr(void);
 void spi1_setSpiISR(void(*handler)(void));
+void (*spi1_getSpiISR(void))(void);
+
+/* DMA transmit on channel 0, paced by SPI1 TX, 16-bit words sent MSB first.
+ * The handler set with spi1_setSpiISR is called when the transfer is done.
+ * The channel only reads data RAM, spi1_dmaWriteWords refuses other sources. */
+bool spi1_dmaCanRead(const void *source, uint16_t count);
+bool spi1_dmaWriteWords(const uint16_t *words, uint16_t count);
+bool spi1_dmaFillWords(uint16_t word, uint16_t count);
+bool spi1_dmaBusy(void);
+void spi1_dmaWait(void);
+void spi1_dmaIsr(void);
 
 #endif // SPI1_DRIVER_H
@@ -0,0 +1,129 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* oledC_DrawCircle over radii 1 to 47: pixels written and commands sent
+ * to the panel, checked against the disk x*x + y*y <= r*r + r, and host
+ * time per draw into the framebuffer, where the span computation the
+ * cache saves is a larger share. Built once with the default
+ * OLEDC_CIRCLE_CACHE_RADIUS and once with every radius cached. */
+
+#include <stdio.h>
+#include <time.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define MAX_RADIUS 47
+#define CENTER 47
+#define REPEAT 200
+#define INK 0xF81F
+
+int check_failures;
+
+static uint32_t diskPixels(uint8_t radius, uint16_t *rows)
+{
+    int16_t x, y;
+    uint32_t limit = (uint32_t)radius * radius + radius, count = 0;
+    *rows = 0;
+    for(y = -radius; y <= radius; y++)
+    {
+        bool rowUsed = false;
+        for(x = -radius; x <= radius; x++)
+        {
+            if((uint32_t)(x * x + y * y) <= limit)
+            {
+                count++;
+                rowUsed = true;
+            }
+        }
+        *rows += rowUsed;
+    }
+    return count;
+}
+
+static bool matchesDisk(uint8_t radius)
+{
+    int16_t x, y;
+    uint32_t limit = (uint32_t)radius * radius + radius;
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            int16_t dx = x - CENTER, dy = y - CENTER;
+            bool inside = (uint32_t)(dx * dx + dy * dy) <= limit;
+            if(sim_panelPixel(x, y) != (inside ? INK : 0))
+            {
+                printf("radius %d: pixel (%d, %d) wrong\n", radius, x, y);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(void)
+{
+    uint32_t pixels = 0, commands = 0, rows = 0;
+    clock_t start;
+    double micros;
+    uint8_t radius;
+    uint16_t i;
+
+    printf("bench_circle: OLEDC_CIRCLE_CACHE_RADIUS %d\n", OLEDC_CIRCLE_CACHE_RADIUS);
+    printf("  %6s %7s %8s\n", "radius", "pixels", "commands");
+    for(radius = 1; radius <= MAX_RADIUS; radius++)
+    {
+        uint16_t diskRows;
+        uint32_t expected = diskPixels(radius, &diskRows);
+        sim_panelStart(0);
+        oledC_DrawCircle(CENTER, CENTER, radius, INK);
+        CHECK(matchesDisk(radius));
+        CHECK_EQ(sim_pixelWrites, expected);
+        /* one window and one RAM write per row at most */
+        CHECK(sim_commandCount <= 3 * diskRows);
+        if(radius == 1 || radius == 8 || radius == 9 || radius == 15 || radius == 16 || radius == 32 || radius == MAX_RADIUS)
+        {
+            printf("  %6d %7lu %8lu\n", radius, (unsigned long)sim_pixelWrites, (unsigned long)sim_commandCount);
+        }
+        pixels += sim_pixelWrites;
+        commands += sim_commandCount;
+        rows += diskRows;
+    }
+    printf("  %6s %7lu %8lu  (%lu rows)\n", "1-47", (unsigned long)pixels, (unsigned long)commands, (unsigned long)rows);
+
+    /* second pass, every cached radius already filled */
+    oledC_setDrawTarget(OLEDC_TARGET_FRAMEBUFFER);
+    start = clock();
+    for(i = 0; i < REPEAT; i++)
+    {
+        for(radius = 1; radius <= MAX_RADIUS; radius++)
+        {
+            oledC_DrawCircle(CENTER, CENTER, radius, INK);
+        }
+    }
+    micros = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / REPEAT;
+    oledC_setDrawTarget(OLEDC_TARGET_PANEL);
+    printf("  framebuffer, radii 1-47: %.1f us per pass\n", micros);
+    return CHECK_DONE();
+}
@@ -0,0 +1,113 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* SPI1 register writes per full-screen clear. The fake spi1 driver counts
+ * the writes the real one makes for each call: five to configure and
+ * enable, one to disable and one per SPI1BUFL load. The baseline is the
+ * per-pixel path the driver used before write sessions: open, two byte
+ * exchanges and close for every pixel. */
+
+#include <stdio.h>
+#include <xc.h>
+#include "../oledDriver/oledC.h"
+#include "../spiDriver/spi1_driver.h"
+#include "sim/sim_panel.h"
+#include "sim/sim_spi1.h"
+#include "sim/check.h"
+
+#define CLEAR_PIXELS (SIM_SCREEN_SIZE * SIM_SCREEN_SIZE)
+
+int check_failures;
+
+static uint16_t countOther(uint16_t color)
+{
+    uint8_t x, y;
+    uint16_t count = 0;
+    for(y = 0; y < SIM_SCREEN_SIZE; y++)
+    {
+        for(x = 0; x < SIM_SCREEN_SIZE; x++)
+        {
+            count += sim_panelPixel(x, y) != color;
+        }
+    }
+    return count;
+}
+
+static void clearPerPixelBaseline(uint16_t color)
+{
+    uint16_t i;
+    oledC_setColumnAddressBounds(0, 95);
+    oledC_setRowAddressBounds(0, 95);
+    oledC_startWritingDisplay();
+    for(i = 0; i < CLEAR_PIXELS; i++)
+    {
+        spi1_open(SPI1_DEFAULT);
+        spi1_exchangeByte(color >> 8);
+        spi1_exchangeByte(color & 0xFF);
+        spi1_close();
+    }
+    oledC_stopWritingDisplay();
+}
+
+static void clearPerPixel(uint16_t color)
+{
+    uint16_t i;
+    oledC_setColumnAddressBounds(0, 95);
+    oledC_setRowAddressBounds(0, 95);
+    for(i = 0; i < CLEAR_PIXELS; i++)
+    {
+        oledC_sendColorInt(color);
+    }
+    oledC_stopWritingDisplay();
+}
+
+static uint32_t measure(const char *name, void (*clear)(uint16_t))
+{
+    uint32_t writes;
+    sim_panelStart(0x1234);
+    sim_spiSfrWrites = 0;
+    clear(0xF81F);
+    writes = sim_spiSfrWrites;
+    CHECK_EQ(countOther(0xF81F), 0);
+    CHECK_EQ(sim_strayBytes, 0);
+    printf("  %-28s %7lu SFR writes, %.2f per pixel\n", name,
+           (unsigned long)writes, (double)writes / CLEAR_PIXELS);
+    return writes;
+}
+
+int main(void)
+{
+    uint32_t baseline, perPixel, session;
+
+    printf("bench_clear: SPI1 register writes per full-screen clear\n");
+    baseline = measure("per-pixel open/close", clearPerPixelBaseline);
+    perPixel = measure("oledC_sendColorInt loop", clearPerPixel);
+    session = measure("oledC_clear (write session)", oledC_clear);
+
+    /* a session pays the configuration once and one load per pixel */
+    CHECK(session < CLEAR_PIXELS + 64);
+    CHECK(session * 7 < baseline);
+    CHECK(perPixel < baseline);
+    printf("  session saves %lu writes (%.1fx fewer)\n",
+           (unsigned long)(baseline - session), (double)baseline / session);
+    return CHECK_DONE();
+}
@@ -0,0 +1,115 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Damage coalescing on the watch face: an hour of second ticks through the
+ * widgets, the compositor and the framebuffer flush. Every rect the
+ * framebuffer reports is recorded; without coalescing each one would be
+ * its own window, with it they go through the damage list the flush uses.
+ * Reports pixels pushed and commands (column, row and WRITE_RAM per window)
+ * per tick, and checks the list's figure against the pixels the panel
+ * model actually received. */
+
+#define main watchMain
+#include "../main.c"
+#undef main
+
+#include <stdio.h>
+#include "../oledDriver/oledC_damage.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define TICKS 3600
+#define MAX_RAW_RECTS 256
+#define WINDOW_COMMANDS 3
+
+int check_failures;
+
+static oledC_rect_t raw[MAX_RAW_RECTS];
+static uint16_t rawCount;
+
+void SYSTEM_Initialize(void)
+{
+}
+
+void __real_oledC_damageAdd(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y);
+
+void __wrap_oledC_damageAdd(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y)
+{
+    if(rawCount < MAX_RAW_RECTS)
+    {
+        raw[rawCount].xs = start_x;
+        raw[rawCount].ys = start_y;
+        raw[rawCount].xe = end_x;
+        raw[rawCount].ye = end_y;
+        rawCount++;
+    }
+    __real_oledC_damageAdd(start_x, start_y, end_x, end_y);
+}
+
+static uint32_t area(const oledC_rect_t *r)
+{
+    return (uint32_t)(r->xe - r->xs + 1) * (r->ye - r->ys + 1);
+}
+
+int main(void)
+{
+    uint32_t rawPixels = 0, rawWindows = 0, pixels = 0, windows = 0;
+    uint32_t panelPixels = 0;
+    oledC_damageList_t list;
+    uint16_t tick, i;
+
+    sim_panelStart(OLEDC_COLOR_BLACK);
+    SetupWatchFace();
+    DrawTimeDate();
+
+    for(tick = 0; tick < TICKS; tick++)
+    {
+        rawCount = 0;
+        sim_panelCountReset();
+        IncrementTime();
+        DrawTimeDate();
+        CHECK(rawCount < MAX_RAW_RECTS);
+
+        list.count = 0;
+        for(i = 0; i < rawCount; i++)
+        {
+            rawPixels += area(&raw[i]);
+            oledC_damageListAdd(&list, raw[i].xs, raw[i].ys, raw[i].xe, raw[i].ye);
+        }
+        rawWindows += rawCount;
+        for(i = 0; i < list.count; i++)
+        {
+            pixels += area(&list.rects[i]);
+        }
+        windows += list.count;
+        panelPixels += sim_pixelWrites;
+    }
+    CHECK_EQ(panelPixels, pixels);
+
+    printf("bench_damage: %d watch face ticks, per tick\n", TICKS);
+    printf("  %-16s %7.1f pixels %5.2f windows %5.2f commands\n", "one per rect",
+           (double)rawPixels / TICKS, (double)rawWindows / TICKS, (double)rawWindows * WINDOW_COMMANDS / TICKS);
+    printf("  %-16s %7.1f pixels %5.2f windows %5.2f commands\n", "coalesced",
+           (double)pixels / TICKS, (double)windows / TICKS, (double)windows * WINDOW_COMMANDS / TICKS);
+    CHECK(windows < rawWindows);
+    return CHECK_DONE();
+}
@@ -0,0 +1,195 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Bus cost per glyph of the 5x8 font at scales 1 to 4, over all 95
+ * printable characters:
+ *   - clearing the cell with oledC_DrawRectangle and drawing the glyph
+ *     transparently, the only opaque text before drawGlyphCell;
+ *   - oledC_DrawCharacterOpaque, which switches to vertical increment and
+ *     back around every cell;
+ *   - oledC_DrawStringOpaque, which switches once per line;
+ *   - the same cell window streamed row by row in the normal increment
+ *     mode, as a row-major blitter would send it.
+ * Reports bus bytes, commands, SPI1 register writes and modeled bus cycles
+ * per glyph, and checks every way leaves the same cell. */
+
+#include <stdio.h>
+#include <string.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "sim/sim_panel.h"
+#include "sim/sim_spi1.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define GLYPHS ('~' - ' ' + 1)
+#define MAX_SCALE 4
+#define FG 0xFFE0
+#define BG 0x0010
+#define PAPER 0x1234
+
+enum method { CLEAR_THEN_DRAW, OPAQUE_CHAR, OPAQUE_STRING, ROW_MAJOR, METHODS };
+
+static const char *methodNames[METHODS] =
+{
+    "clear + DrawCharacter", "DrawCharacterOpaque", "DrawStringOpaque", "row-major window"
+};
+
+int check_failures;
+
+typedef struct
+{
+    uint32_t bytes, commands, sfrWrites, cycles;
+} cost_t;
+
+static uint16_t cells[GLYPHS][(5 * MAX_SCALE + 1) * 8 * MAX_SCALE];
+
+static void startCounting(void)
+{
+    sim_panelCountReset();
+    sim_spiSfrWrites = 0;
+    sim_spiTimingReset();
+}
+
+static void addCost(cost_t *cost)
+{
+    cost->bytes += sim_commandBytes + sim_dataBytes;
+    cost->commands += sim_commandCount;
+    cost->sfrWrites += sim_spiSfrWrites;
+    cost->cycles += sim_spiCycles;
+}
+
+static void readCell(uint8_t x, uint8_t width, uint8_t height, uint16_t *pixels)
+{
+    uint8_t cx, cy;
+    for(cy = 0; cy < height; cy++)
+    {
+        for(cx = 0; cx < width; cx++)
+        {
+            *pixels++ = sim_panelPixel(x + cx, cy);
+        }
+    }
+}
+
+static void streamRows(uint8_t x, uint8_t width, uint8_t height, const uint16_t *pixels)
+{
+    uint8_t row;
+    oledC_setColumnAddressBounds(x, x + width - 1);
+    oledC_setRowAddressBounds(0, height - 1);
+    oledC_beginWriteSession();
+    for(row = 0; row < height; row++)
+    {
+        oledC_sendPixels(pixels + row * width, width);
+    }
+    oledC_endWriteSession();
+}
+
+static cost_t measure(enum method method, uint8_t scale)
+{
+    static uint16_t cell[(5 * MAX_SCALE + 1) * 8 * MAX_SCALE];
+    uint8_t width = 5 * scale + 1, height = 8 * scale, perLine = SIZE / width;
+    cost_t cost = { 0, 0, 0, 0 };
+    uint8_t first, i;
+
+    for(first = 0; first < GLYPHS; first += perLine)
+    {
+        uint8_t count = GLYPHS - first < perLine ? GLYPHS - first : perLine;
+        char line[SIZE + 1];
+        for(i = 0; i < count; i++)
+        {
+            line[i] = ' ' + first + i;
+        }
+        line[count] = 0;
+
+        sim_panelStart(PAPER);
+        startCounting();
+        switch(method)
+        {
+        case CLEAR_THEN_DRAW:
+            for(i = 0; i < count; i++)
+            {
+                oledC_DrawRectangle(i * width, 0, i * width + width - 1, height - 1, BG);
+                oledC_DrawCharacter(i * width, 0, scale, scale, line[i], FG);
+            }
+            break;
+        case OPAQUE_CHAR:
+            for(i = 0; i < count; i++)
+            {
+                oledC_DrawCharacterOpaque(i * width, 0, scale, scale, line[i], FG, BG);
+            }
+            break;
+        case OPAQUE_STRING:
+            oledC_DrawStringOpaque(0, 0, scale, scale, (uint8_t *)line, FG, BG);
+            break;
+        case ROW_MAJOR:
+            for(i = 0; i < count; i++)
+            {
+                streamRows(i * width, width, height, cells[first + i]);
+            }
+            break;
+        default:
+            break;
+        }
+        addCost(&cost);
+        CHECK_EQ(sim_strayBytes, 0);
+
+        for(i = 0; i < count; i++)
+        {
+            readCell(i * width, width, height, cell);
+            if(method == CLEAR_THEN_DRAW)
+            {
+                memcpy(cells[first + i], cell, sizeof(uint16_t) * width * height);
+            }
+            else if(memcmp(cells[first + i], cell, sizeof(uint16_t) * width * height))
+            {
+                printf("%s, scale %d: '%c' differs\n", methodNames[method], scale, line[i]);
+                check_failures++;
+            }
+        }
+    }
+    return cost;
+}
+
+int main(void)
+{
+    cost_t costs[METHODS];
+    uint8_t scale;
+    enum method m;
+
+    printf("bench_glyph: 5x8 font, %d glyphs, per glyph\n", GLYPHS);
+    for(scale = 1; scale <= MAX_SCALE; scale++)
+    {
+        printf("  scale %d, %dx%d cell\n", scale, 5 * scale + 1, 8 * scale);
+        for(m = 0; m < METHODS; m++)
+        {
+            costs[m] = measure(m, scale);
+            printf("    %-22s %7.1f bytes %5.2f commands %7.1f SFR writes %8.1f cycles\n", methodNames[m],
+                   (double)costs[m].bytes / GLYPHS, (double)costs[m].commands / GLYPHS,
+                   (double)costs[m].sfrWrites / GLYPHS, (double)costs[m].cycles / GLYPHS);
+        }
+        CHECK(costs[OPAQUE_CHAR].bytes < costs[CLEAR_THEN_DRAW].bytes);
+        CHECK(costs[OPAQUE_STRING].bytes <= costs[OPAQUE_CHAR].bytes);
+        /* both stream every pixel of the cell once */
+        CHECK(costs[OPAQUE_STRING].cycles <= costs[ROW_MAJOR].cycles);
+    }
+    return CHECK_DONE();
+}
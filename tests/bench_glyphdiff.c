@@ -0,0 +1,124 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* A day of seconds ticks of an HH:MM:SS clock through the glyph-diff cache.
+ * Each changed digit goes through oledC_DrawCharacterDiff; the same ticks
+ * are replayed with a whole-cell redraw and a whole-string redraw. The
+ * bytes each approach sends per tick are reported, and the frame the diffs
+ * leave after a day must equal a fresh full redraw. */
+
+#include <stdio.h>
+#include <string.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define CLOCK_X 4
+#define CLOCK_Y 36
+#define SCALE_X 2
+#define SCALE_Y 3
+#define ADVANCE (5 * SCALE_X + 1)
+#define START_SECOND (7 * 3600L + 45 * 60 + 30)
+#define DAY_TICKS 86399L
+#define FG 0xFFE0
+#define BG 0x0010
+
+enum update { UPDATE_DIFF, UPDATE_CELL, UPDATE_STRING };
+
+int check_failures;
+
+static void format(char *text, long second)
+{
+    second %= 86400L;
+    sprintf(text, "%02ld:%02ld:%02ld", second / 3600, second / 60 % 60, second % 60);
+}
+
+static uint32_t busBytes(void)
+{
+    return sim_commandBytes + sim_dataBytes;
+}
+
+/* returns the bytes sent over the day and leaves the last frame on the panel */
+static uint32_t runDay(enum update update)
+{
+    char shown[9], next[9];
+    long tick;
+    uint8_t i;
+
+    sim_panelStart(BG);
+    format(shown, START_SECOND);
+    oledC_DrawStringOpaque(CLOCK_X, CLOCK_Y, SCALE_X, SCALE_Y, (uint8_t *)shown, FG, BG);
+    sim_panelCountReset();
+    for(tick = 1; tick <= DAY_TICKS; tick++)
+    {
+        format(next, START_SECOND + tick);
+        if(update == UPDATE_STRING)
+        {
+            oledC_DrawStringOpaque(CLOCK_X, CLOCK_Y, SCALE_X, SCALE_Y, (uint8_t *)next, FG, BG);
+        }
+        for(i = 0; update != UPDATE_STRING && i < 8; i++)
+        {
+            if(shown[i] == next[i])
+            {
+                continue;
+            }
+            if(update == UPDATE_DIFF)
+            {
+                oledC_DrawCharacterDiff(CLOCK_X + i * ADVANCE, CLOCK_Y, SCALE_X, SCALE_Y, shown[i], next[i], FG, BG);
+            }
+            else
+            {
+                oledC_DrawCharacterOpaque(CLOCK_X + i * ADVANCE, CLOCK_Y, SCALE_X, SCALE_Y, next[i], FG, BG);
+            }
+        }
+        memcpy(shown, next, sizeof(shown));
+    }
+    CHECK_EQ(sim_strayBytes, 0);
+    return busBytes();
+}
+
+int main(void)
+{
+    static uint16_t diffed[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE], redrawn[sizeof(diffed) / 2];
+    uint32_t diffBytes, cellBytes, stringBytes;
+    char last[9];
+
+    diffBytes = runDay(UPDATE_DIFF);
+    sim_panelSnapshot(diffed);
+    cellBytes = runDay(UPDATE_CELL);
+    stringBytes = runDay(UPDATE_STRING);
+
+    sim_panelStart(BG);
+    format(last, START_SECOND + DAY_TICKS);
+    oledC_DrawStringOpaque(CLOCK_X, CLOCK_Y, SCALE_X, SCALE_Y, (uint8_t *)last, FG, BG);
+    sim_panelSnapshot(redrawn);
+    CHECK_EQ(sim_countDiff(diffed, redrawn), 0);
+
+    printf("bench_glyphdiff: %ld ticks of HH:MM:SS at %dx%d, bytes per tick\n", DAY_TICKS, SCALE_X, SCALE_Y);
+    printf("  glyph diff      %7.1f\n", (double)diffBytes / DAY_TICKS);
+    printf("  changed cells   %7.1f\n", (double)cellBytes / DAY_TICKS);
+    printf("  whole string    %7.1f\n", (double)stringBytes / DAY_TICKS);
+    CHECK(diffBytes < cellBytes);
+    CHECK(cellBytes < stringBytes);
+    return CHECK_DONE();
+}
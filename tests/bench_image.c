@@ -0,0 +1,150 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Cost of oledC_DrawImage decoding the imgc.py fixture straight to the
+ * panel against drawing the decoded pixels one oledC_DrawPoint at a time,
+ * for a fully visible placement (one streamed window) and one cut by the
+ * right edge (clipped run by run). Reports bus bytes, SPI1 register writes
+ * and host time per draw. */
+
+#include <stdio.h>
+#include <time.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "build/img_fixture.h"
+#include "sim/sim_panel.h"
+#include "sim/sim_spi1.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define REPEAT 200
+
+int check_failures;
+
+static uint16_t decoded[SIZE * SIZE];
+
+/* what the image decodes to, read back from a streamed draw */
+static void decodeFixture(void)
+{
+    const oledC_image_t *image = &oledC_image_fixture;
+    uint8_t x, y;
+    sim_panelStart(0);
+    oledC_DrawImage(0, 0, image);
+    for(y = 0; y < image->height; y++)
+    {
+        for(x = 0; x < image->width; x++)
+        {
+            decoded[y * image->width + x] = sim_panelPixel(x, y);
+        }
+    }
+}
+
+static void drawPerPixel(uint8_t x0, uint8_t y0)
+{
+    const oledC_image_t *image = &oledC_image_fixture;
+    uint8_t x, y;
+    for(y = 0; y < image->height; y++)
+    {
+        for(x = 0; x < image->width; x++)
+        {
+            oledC_DrawPoint(x0 + x, y0 + y, decoded[y * image->width + x]);
+        }
+    }
+}
+
+static void drawImage(uint8_t x, uint8_t y)
+{
+    oledC_DrawImage(x, y, &oledC_image_fixture);
+}
+
+typedef struct
+{
+    uint32_t bytes;
+    uint32_t sfrWrites;
+    double micros;
+} cost_t;
+
+static cost_t measure(void (*draw)(uint8_t, uint8_t), uint8_t x, uint8_t y)
+{
+    static uint16_t first[SIZE * SIZE], again[SIZE * SIZE];
+    cost_t cost;
+    clock_t start;
+    uint16_t i;
+
+    sim_panelStart(0);
+    sim_spiSfrWrites = 0;
+    draw(x, y);
+    cost.bytes = sim_commandBytes + sim_dataBytes;
+    cost.sfrWrites = sim_spiSfrWrites;
+    sim_panelSnapshot(first);
+
+    start = clock();
+    for(i = 0; i < REPEAT; i++)
+    {
+        draw(x, y);
+    }
+    cost.micros = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / REPEAT;
+    sim_panelSnapshot(again);
+    CHECK_EQ(sim_countDiff(again, first), 0);
+    CHECK_EQ(sim_strayBytes, 0);
+    return cost;
+}
+
+static void report(const char *name, cost_t cost)
+{
+    printf("  %-22s %7lu bytes %7lu SFR writes %8.1f us\n", name,
+           (unsigned long)cost.bytes, (unsigned long)cost.sfrWrites, cost.micros);
+}
+
+int main(void)
+{
+    static uint16_t byImage[SIZE * SIZE], byPixel[SIZE * SIZE];
+    cost_t image, pixels, clippedImage, clippedPixels;
+
+    decodeFixture();
+    printf("bench_image: %dx%d fixture, %u RLE bytes, per draw\n",
+           oledC_image_fixture.width, oledC_image_fixture.height, oledC_image_fixture.length);
+
+    image = measure(drawImage, 10, 20);
+    sim_panelSnapshot(byImage);
+    pixels = measure(drawPerPixel, 10, 20);
+    sim_panelSnapshot(byPixel);
+    CHECK_EQ(sim_countDiff(byImage, byPixel), 0);
+
+    clippedImage = measure(drawImage, 70, 30);
+    sim_panelSnapshot(byImage);
+    clippedPixels = measure(drawPerPixel, 70, 30);
+    sim_panelSnapshot(byPixel);
+    CHECK_EQ(sim_countDiff(byImage, byPixel), 0);
+
+    report("DrawImage", image);
+    report("per-pixel DrawPoint", pixels);
+    report("DrawImage, clipped", clippedImage);
+    report("per-pixel, clipped", clippedPixels);
+    /* the address shadow keeps per-pixel bus traffic close; the cost is
+     * in register writes and CPU time */
+    CHECK(image.bytes <= pixels.bytes);
+    CHECK(image.sfrWrites * 4 < pixels.sfrWrites);
+    CHECK(clippedImage.bytes <= clippedPixels.bytes);
+    CHECK(clippedImage.sfrWrites * 4 < clippedPixels.sfrWrites);
+    return CHECK_DONE();
+}
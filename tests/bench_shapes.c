@@ -0,0 +1,308 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Scene list churn: random oledC_insertShape, oledC_deleteShape and
+ * oledC_moveShape calls, checked step by step against an array of
+ * handles, then timed against the shifting array the shape store used to
+ * be (every entry above the index copied, the whole struct each time).
+ * A second phase keeps the pool full and adds through oledC_addShape,
+ * which has to evict the top shape before every insert. */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../oledDriver/oledC_shapeHandler.h"
+#include "sim/check.h"
+
+#define CAPACITY OLEDC_MAX_SHAPES
+#define CHURN_OPS 20000
+#define FULL_OPS 5000
+#define REPEAT 20
+
+enum op { OP_INSERT, OP_DELETE, OP_MOVE };
+
+int check_failures;
+
+static uint32_t seed;
+static oledC_shapeHandle_t order[CAPACITY];
+static uint16_t ids[CAPACITY];
+static uint8_t count;
+static uint16_t nextId;
+
+/* the entry the shape store shifted before the pool */
+typedef struct
+{
+    enum OLEDC_SHAPE type;
+    shape_params_t params;
+    bool active;
+    void (*draw)(void *shape);
+} old_shape_t;
+
+static old_shape_t oldShapes[CAPACITY];
+static uint32_t oldCopies;
+
+static uint16_t randomBelow(uint16_t limit)
+{
+    seed = seed * 1103515245UL + 12345UL;
+    return (uint16_t)((seed >> 16) % limit);
+}
+
+/* the shape's id is kept in its coordinates */
+static void shapeParams(shape_params_t *p, uint16_t id)
+{
+    memset(p, 0, sizeof(*p));
+    p->rectangle.color = 0xF800;
+    p->rectangle.xs = p->rectangle.xe = id & 0xFF;
+    p->rectangle.ys = p->rectangle.ye = id >> 8;
+}
+
+static uint16_t shapeId(oledC_shapeHandle_t handle)
+{
+    enum OLEDC_SHAPE type;
+    shape_params_t p;
+    if(!oledC_getShapeParams(handle, &type, &p))
+    {
+        return 0xFFFF;
+    }
+    return p.rectangle.xs | (uint16_t)p.rectangle.ys << 8;
+}
+
+static bool listMatches(void)
+{
+    oledC_shapeHandle_t handle = oledC_firstShape();
+    uint8_t i;
+    for(i = 0; i < count; i++, handle = oledC_nextShape(handle))
+    {
+        if(handle != order[i] || shapeId(handle) != ids[i])
+        {
+            printf("z %d: handle %d id %d, expected handle %d id %d\n",
+                   i, handle, shapeId(handle), order[i], ids[i]);
+            return false;
+        }
+    }
+    return handle == OLEDC_SHAPE_NONE;
+}
+
+static void modelInsert(uint8_t at, oledC_shapeHandle_t handle, uint16_t id)
+{
+    memmove(&order[at + 1], &order[at], count - at);
+    memmove(&ids[at + 1], &ids[at], (count - at) * sizeof(ids[0]));
+    order[at] = handle;
+    ids[at] = id;
+    count++;
+}
+
+static void modelDelete(uint8_t at)
+{
+    count--;
+    memmove(&order[at], &order[at + 1], count - at);
+    memmove(&ids[at], &ids[at + 1], (count - at) * sizeof(ids[0]));
+}
+
+/* mostly half full to full, so deletes and inserts both happen */
+static enum op randomOp(void)
+{
+    if(count < CAPACITY / 2)
+    {
+        return OP_INSERT;
+    }
+    if(count == CAPACITY)
+    {
+        return randomBelow(2) ? OP_DELETE : OP_MOVE;
+    }
+    return (enum op)randomBelow(3);
+}
+
+static void churn(bool verify)
+{
+    shape_params_t p;
+    uint32_t i;
+    initShapesMem();
+    count = 0;
+    nextId = 0;
+    seed = 4321;
+    for(i = 0; i < CHURN_OPS; i++)
+    {
+        enum op op = randomOp();
+        uint8_t at = randomBelow(count + 1), to;
+        oledC_shapeHandle_t handle, before;
+        switch(op)
+        {
+        case OP_INSERT:
+            before = at < count ? order[at] : OLEDC_SHAPE_NONE;
+            shapeParams(&p, nextId);
+            handle = oledC_insertShape(OLED_SHAPE_RECTANGLE, &p, before);
+            modelInsert(at, handle, nextId++);
+            break;
+        case OP_DELETE:
+            at = at == count ? count - 1 : at;
+            oledC_deleteShape(order[at]);
+            modelDelete(at);
+            break;
+        case OP_MOVE:
+            at = at == count ? count - 1 : at;
+            handle = order[at];
+            to = randomBelow(count);
+            before = to < count - 1 ? order[to + (to >= at)] : OLEDC_SHAPE_NONE;
+            oledC_moveShape(handle, before);
+            {
+                uint16_t id = ids[at];
+                modelDelete(at);
+                modelInsert(to, handle, id);
+            }
+            break;
+        }
+        if(verify && !listMatches())
+        {
+            printf("after op %lu (%d)\n", (unsigned long)i, op);
+            check_failures++;
+            return;
+        }
+    }
+}
+
+/* what the old oledC_addShape and oledC_removeShape did */
+static void oldRemove(uint8_t at)
+{
+    uint8_t i;
+    for(i = at; i < CAPACITY - 1; i++)
+    {
+        oldShapes[i] = oldShapes[i + 1];
+        oldCopies++;
+    }
+    oldShapes[CAPACITY - 1].active = false;
+}
+
+static void oldAdd(uint8_t at, const shape_params_t *p)
+{
+    uint8_t i;
+    for(i = CAPACITY - 1; i > at; i--)
+    {
+        oldShapes[i] = oldShapes[i - 1];
+        oldCopies++;
+    }
+    oldShapes[at].type = OLED_SHAPE_RECTANGLE;
+    oldShapes[at].params = *p;
+    oldShapes[at].active = true;
+}
+
+static void oldChurn(void)
+{
+    shape_params_t p;
+    uint32_t i;
+    count = 0;
+    nextId = 0;
+    seed = 4321;
+    for(i = 0; i < CHURN_OPS; i++)
+    {
+        enum op op = randomOp();
+        uint8_t at = randomBelow(count + 1), to;
+        old_shape_t moved;
+        switch(op)
+        {
+        case OP_INSERT:
+            shapeParams(&p, nextId++);
+            oldAdd(at, &p);
+            count++;
+            break;
+        case OP_DELETE:
+            at = at == count ? count - 1 : at;
+            oldRemove(at);
+            count--;
+            break;
+        case OP_MOVE:
+            at = at == count ? count - 1 : at;
+            to = randomBelow(count);
+            moved = oldShapes[at];
+            oldRemove(at);
+            oldAdd(to, &moved.params);
+            break;
+        }
+    }
+}
+
+/* full pool: every oledC_addShape evicts the top shape first */
+static void fullPool(void)
+{
+    shape_params_t p;
+    uint32_t i;
+    initShapesMem();
+    count = 0;
+    seed = 99;
+    for(nextId = 0; nextId < CAPACITY; nextId++)
+    {
+        shapeParams(&p, nextId);
+        modelInsert(count, oledC_insertShape(OLED_SHAPE_RECTANGLE, &p, OLEDC_SHAPE_NONE), nextId);
+    }
+    for(i = 0; i < FULL_OPS; i++)
+    {
+        uint8_t at = randomBelow(CAPACITY);
+        oledC_shapeHandle_t evicted = order[count - 1];
+        shapeParams(&p, nextId);
+        oledC_addShape(at, OLED_SHAPE_RECTANGLE, &p);
+        /* the freed slot of the evicted shape is the one reused */
+        modelDelete(count - 1);
+        modelInsert(at < count ? at : count, evicted, nextId++);
+        if(!listMatches())
+        {
+            printf("full pool, after add %lu at %d\n", (unsigned long)i, at);
+            check_failures++;
+            return;
+        }
+    }
+}
+
+static double timed(void (*run)(void))
+{
+    clock_t start = clock();
+    uint8_t i;
+    for(i = 0; i < REPEAT; i++)
+    {
+        run();
+    }
+    return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / REPEAT / CHURN_OPS;
+}
+
+static void churnOnly(void)
+{
+    churn(false);
+}
+
+int main(void)
+{
+    oledC_shapeStoreStats_t stats;
+    double listNs, arrayNs;
+
+    churn(true);
+    fullPool();
+    oledC_shapeStoreStats(&stats);
+    CHECK_EQ(stats.shapes, CAPACITY);
+
+    listNs = timed(churnOnly);
+    arrayNs = timed(oldChurn);
+    printf("bench_shapes: %d random insert / delete / move, %d slots\n", CHURN_OPS, CAPACITY);
+    printf("  %-16s %6.1f ns per op %3d bytes per shape, no copies\n", "linked pool", listNs, stats.bytesPerShape);
+    printf("  %-16s %6.1f ns per op %3d bytes per shape, %.1f copies per op\n", "shifting array", arrayNs,
+           (int)sizeof(old_shape_t), (double)oldCopies / REPEAT / CHURN_OPS);
+    printf("  full pool: %d oledC_addShape calls, each evicting the top shape\n", FULL_OPS);
+    return CHECK_DONE();
+}
@@ -0,0 +1,112 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Bus time of the pixel paths in each SPI1 session mode, under the shift
+ * clock model of sim/spi1_sim.c (SCK = FCY / 2, 4 MHz FCY). The pixel
+ * session normally opens SPI1_WORD_FIFO; sim_spiSetWordMode swaps in
+ * SPI1_WORD or the 8-bit SPI1_DEFAULT to compare. Reports CPU cycles,
+ * time and pixels per second for a clear, the imgc.py fixture and an
+ * opaque text line, and checks every mode leaves the same panel. */
+
+#include <stdio.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "build/img_fixture.h"
+#include "sim/sim_panel.h"
+#include "sim/sim_spi1.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define MODES 3
+#define FG 0xFFFF
+#define BG 0x0010
+
+int check_failures;
+
+static const spi1_modes modes[MODES] = { SPI1_DEFAULT, SPI1_WORD, SPI1_WORD_FIFO };
+static const char *modeNames[MODES] = { "8-bit", "WORD", "WORD_FIFO" };
+
+static void drawClear(void)
+{
+    oledC_clear(BG);
+}
+
+static void drawImage(void)
+{
+    oledC_DrawImage(24, 30, &oledC_image_fixture);
+}
+
+static void drawText(void)
+{
+    oledC_DrawStringOpaque(4, 40, 2, 2, (uint8_t *)"12:45:07", FG, BG);
+}
+
+typedef struct
+{
+    const char *name;
+    void (*draw)(void);
+} workload_t;
+
+static const workload_t workloads[] =
+{
+    { "oledC_clear", drawClear },
+    { "DrawImage 48x36", drawImage },
+    { "text line 2x2", drawText },
+};
+
+int main(void)
+{
+    static uint16_t reference[SIZE * SIZE], panel[SIZE * SIZE];
+    uint32_t cycles[MODES];
+    uint8_t w, m;
+
+    printf("bench_spi: bus time per draw, SCK = FCY / 2\n");
+    for(w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++)
+    {
+        uint32_t pixels = 0;
+        printf("  %s\n", workloads[w].name);
+        for(m = 0; m < MODES; m++)
+        {
+            sim_spiSetWordMode(modes[m]);
+            sim_panelStart(0);
+            sim_spiTimingReset();
+            workloads[w].draw();
+            cycles[m] = sim_spiCycles;
+            pixels = sim_pixelWrites;
+            sim_panelSnapshot(m ? panel : reference);
+            if(m)
+            {
+                CHECK_EQ(sim_countDiff(panel, reference), 0);
+            }
+            CHECK_EQ(sim_strayBytes, 0);
+            printf("    %-10s %7lu cycles %8.1f us %9.0f pixels/s\n", modeNames[m],
+                   (unsigned long)cycles[m], cycles[m] * 1e6 / (double)FCY,
+                   pixels * (double)FCY / cycles[m]);
+        }
+        /* a word per pixel beats two byte exchanges; the FIFO only saves
+         * the CPU time it overlaps with the shifter */
+        CHECK(cycles[1] < cycles[0]);
+        CHECK(cycles[2] <= cycles[1]);
+    }
+    sim_spiSetWordMode(SPI1_WORD_FIFO);
+    return CHECK_DONE();
+}
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+"""Print every glyph tools/fontc.py compiles from tools/fonts/fonts.txt as
+rows of '#' and '.', taken as fontc hands them to pack(), for test_fonts to
+compare the rendered cells with.
+
+Usage: font_glyphs.py > build/font_glyphs.txt
+"""
+import os
+import sys
+
+TOOLS = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "tools")
+sys.path.insert(0, TOOLS)
+sys.dont_write_bytecode = True  # keep tools/ free of __pycache__
+import fontc  # noqa: E402
+
+
+class Capture:
+    """Keeps the glyph rows fontc hands to pack(), in table order"""
+
+    def __init__(self):
+        self.rows = []
+        self.pack = fontc.pack
+
+    def __call__(self, rows, height):
+        self.rows.append(rows)
+        return self.pack(rows, height)
+
+
+def main():
+    manifest = os.path.join(TOOLS, "fonts", "fonts.txt")
+    root = os.path.dirname(manifest)
+    with open(manifest) as f:
+        for line in f:
+            words = line.split("#", 1)[0].split()
+            if not words:
+                continue
+            options = dict(w.partition("=")[::2] for w in words[2:])
+            capture = fontc.pack = Capture()
+            font = fontc.compile_font(words[0], os.path.join(root, words[1]), options)
+            fontc.pack = capture.pack
+            glyphs = iter(capture.rows)
+            print("font %s %d %d" % (font["name"], font["height"], font["spacing"]))
+            for index, width in enumerate(font["widths"]):
+                if width:
+                    print("glyph %d %d" % (font["first"] + index, width))
+                    for row in next(glyphs):
+                        print("".join("#" if bit else "." for bit in row))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,52 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <xc.h>
+
+volatile SPI1CON1L_t sfr_SPI1CON1L;
+volatile SPI1STATL_t sfr_SPI1STATL;
+volatile DMACON_t sfr_DMACON;
+volatile DMACH0_t sfr_DMACH0;
+volatile DMAINT0_t sfr_DMAINT0;
+volatile IFS0_t sfr_IFS0;
+volatile IEC0_t sfr_IEC0;
+volatile IFS3_t sfr_IFS3;
+volatile TCON_t sfr_T1CON;
+volatile TCON_t sfr_T2CON;
+volatile IPC0_t sfr_IPC0;
+volatile PORT_t sfr_TRISB;
+volatile PORT_t sfr_LATA;
+volatile PORT_t sfr_LATB;
+volatile PORT_t sfr_LATC;
+volatile PORT_t sfr_PORTA;
+volatile uint16_t SPI1CON1H;
+volatile uint16_t SPI1BRGL;
+volatile uint16_t SPI1BUFL;
+volatile uint16_t DMAL;
+volatile uint16_t DMAH;
+volatile uint16_t DMASRC0;
+volatile uint16_t DMADST0;
+volatile uint16_t DMACNT0;
+volatile uint16_t PR1;
+volatile uint16_t TMR1;
+volatile uint16_t PR2;
+volatile uint16_t TMR2;
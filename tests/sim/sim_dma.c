@@ -0,0 +1,101 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <xc.h>
+#include "sim_dma.h"
+
+uint8_t sim_spiBytes[SIM_DMA_MAX_BYTES];
+uint32_t sim_spiByteCount;
+
+static const uint8_t *ramBlock;
+static const uint8_t *flashBlock;
+static size_t flashSize;
+
+void sim_dmaReset(void)
+{
+    sim_spiByteCount = 0;
+    ramBlock = NULL;
+}
+
+void sim_dmaMapFlash(const void *block, size_t size)
+{
+    flashBlock = block;
+    flashSize = size;
+}
+
+uint16_t sim_dmaAddress(const volatile void *p)
+{
+    const uint8_t *b = (const uint8_t *)p;
+    if(p == &SPI1BUFL)
+    {
+        return SIM_DMA_SPI1BUF_ADDRESS;
+    }
+    if(flashBlock && b >= flashBlock && b < flashBlock + flashSize)
+    {
+        return SIM_DMA_PSV_ADDRESS + (uint16_t)(b - flashBlock);
+    }
+    ramBlock = b;
+    return SIM_DMA_RAM_ADDRESS;
+}
+
+static void shiftOut(uint16_t word)
+{
+    if(SPI1CON1Lbits.MODE16)
+    {
+        sim_spiBytes[sim_spiByteCount++ % SIM_DMA_MAX_BYTES] = word >> 8;
+    }
+    sim_spiBytes[sim_spiByteCount++ % SIM_DMA_MAX_BYTES] = word & 0xFF;
+}
+
+uint16_t sim_dmaRun(void)
+{
+    uint16_t moved = 0;
+    const uint8_t *source;
+    if(!DMACONbits.DMAEN || !DMACH0bits.CHEN || !SPI1CON1Lbits.SPIEN)
+    {
+        return 0;
+    }
+    /* the channel only reaches addresses between DMAL and DMAH */
+    if(DMASRC0 < DMAL || DMASRC0 > DMAH || DMADST0 != SIM_DMA_SPI1BUF_ADDRESS)
+    {
+        DMAINT0bits.HIGHIF = DMASRC0 > DMAH;
+        DMAINT0bits.LOWIF = DMASRC0 < DMAL;
+        return 0;
+    }
+    source = ramBlock;
+    while(DMACNT0 > 0)
+    {
+        shiftOut((uint16_t)(source[0] | source[1] << 8));
+        if(DMACH0bits.SAMODE == 1)
+        {
+            source += 2;
+        }
+        DMACNT0--;
+        moved++;
+    }
+    DMACH0bits.CHREQ = 0;
+    DMAINT0bits.DONEIF = 1;
+    IFS0bits.DMA0IF = 1;
+    SPI1STATLbits.SPITBE = 1;
+    SPI1STATLbits.SRMT = 1;
+    return moved;
+}
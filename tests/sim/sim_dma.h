@@ -0,0 +1,49 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef SIM_DMA_H
+#define	SIM_DMA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Host model of DMA channel 0 moving words into SPI1BUFL. Host pointers do
+ * not fit the 16-bit DMA address registers, so the driver asks
+ * sim_dmaAddress() for one: RAM objects land at SIM_DMA_RAM_ADDRESS and
+ * blocks registered with sim_dmaMapFlash() land in the PSV window. */
+
+#define SIM_DMA_RAM_ADDRESS     0x1000
+#define SIM_DMA_PSV_ADDRESS     0x8000
+#define SIM_DMA_SPI1BUF_ADDRESS 0x0308
+#define SIM_DMA_MAX_BYTES       32768
+
+extern uint8_t sim_spiBytes[SIM_DMA_MAX_BYTES];
+extern uint32_t sim_spiByteCount;
+
+void sim_dmaReset(void);
+void sim_dmaMapFlash(const void *block, size_t size);
+uint16_t sim_dmaAddress(const volatile void *p);
+/* Runs a started transfer to completion and raises the done flags the way
+ * the hardware does; returns the number of words moved */
+uint16_t sim_dmaRun(void);
+
+#endif	/* SIM_DMA_H */
@@ -0,0 +1,336 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <xc.h>
+#include "sim_panel.h"
+#include "../../oledDriver/oledC.h"
+
+uint16_t sim_gram[SIM_GRAM_SIZE][SIM_GRAM_SIZE];
+uint32_t sim_commandBytes;
+uint32_t sim_dataBytes;
+uint32_t sim_pixelWrites;
+uint32_t sim_strayBytes;
+uint8_t sim_commandTrace[SIM_TRACE_SIZE];
+uint32_t sim_commandCount;
+uint32_t sim_addressCommands;
+uint32_t sim_redundantAddressCommands;
+
+static struct
+{
+    uint8_t command;
+    uint8_t argCount;
+    uint8_t args[2];
+    uint8_t colStart, colEnd, rowStart, rowEnd;
+    uint8_t col, row;
+    /* no column / row command since the last remap command */
+    bool colStale, rowStale;
+    uint8_t remap;
+    uint8_t startLine;
+    bool lowByte;
+    uint8_t pending;
+} panel;
+
+void sim_panelReset(uint16_t color)
+{
+    uint8_t x, y;
+    for(y = 0; y < SIM_GRAM_SIZE; y++)
+    {
+        for(x = 0; x < SIM_GRAM_SIZE; x++)
+        {
+            sim_gram[y][x] = color;
+        }
+    }
+    panel.command = 0;
+    panel.colStart = panel.rowStart = panel.col = panel.row = 0;
+    panel.colEnd = panel.rowEnd = SIM_GRAM_SIZE - 1;
+    panel.remap = 0;
+    panel.colStale = panel.rowStale = true;
+    panel.startLine = 0;
+    sim_panelCountReset();
+}
+
+void sim_panelStart(uint16_t color)
+{
+    sim_panelReset(color);
+    LATCbits.LATC9 = 1;
+    oledC_invalidateWindow();
+    oledC_setDisplayOrientation();
+    oledC_setColumnAddressBounds(0, 95);
+    oledC_setRowAddressBounds(0, 95);
+    sim_panelCountReset();
+}
+
+void sim_panelCountReset(void)
+{
+    sim_commandBytes = sim_dataBytes = sim_strayBytes = sim_pixelWrites = 0;
+    sim_commandCount = sim_addressCommands = sim_redundantAddressCommands = 0;
+}
+
+static void advance(void)
+{
+    if(panel.remap & 0x01)
+    {
+        if(panel.row++ >= panel.rowEnd)
+        {
+            panel.row = panel.rowStart;
+            panel.col = panel.col >= panel.colEnd ? panel.colStart : panel.col + 1;
+        }
+        return;
+    }
+    if(panel.col++ >= panel.colEnd)
+    {
+        panel.col = panel.colStart;
+        panel.row = panel.row >= panel.rowEnd ? panel.rowStart : panel.row + 1;
+    }
+}
+
+static uint8_t dataByte(uint8_t byte)
+{
+    uint8_t out = 0xFF;
+    uint16_t *cell = &sim_gram[panel.row & 0x7F][panel.col & 0x7F];
+    switch(panel.command)
+    {
+    case 0x15:
+    case 0x75:
+        if(panel.argCount < 2)
+        {
+            panel.args[panel.argCount++] = byte;
+        }
+        if(panel.argCount == 2 && panel.command == 0x15)
+        {
+            if(!panel.colStale && panel.col == panel.colStart &&
+               panel.colStart == panel.args[0] && panel.colEnd == panel.args[1])
+            {
+                sim_redundantAddressCommands++;
+            }
+            panel.colStart = panel.col = panel.args[0];
+            panel.colEnd = panel.args[1];
+            panel.colStale = false;
+            sim_addressCommands++;
+        }
+        else if(panel.argCount == 2)
+        {
+            if(!panel.rowStale && panel.row == panel.rowStart &&
+               panel.rowStart == panel.args[0] && panel.rowEnd == panel.args[1])
+            {
+                sim_redundantAddressCommands++;
+            }
+            panel.rowStart = panel.row = panel.args[0];
+            panel.rowEnd = panel.args[1];
+            panel.rowStale = false;
+            sim_addressCommands++;
+        }
+        break;
+    case 0xA0:
+        if(panel.argCount++ == 0)
+        {
+            panel.remap = byte;
+            panel.colStale = panel.rowStale = true;
+        }
+        break;
+    case 0xA1:
+        panel.startLine = byte & 0x7F;
+        break;
+    case 0x5C:
+        if(!panel.lowByte)
+        {
+            panel.pending = byte;
+        }
+        else
+        {
+            *cell = (uint16_t)panel.pending << 8 | byte;
+            sim_pixelWrites++;
+            advance();
+        }
+        panel.lowByte = !panel.lowByte;
+        break;
+    case 0x5D:
+        if(!panel.lowByte)
+        {
+            out = *cell >> 8;
+        }
+        else
+        {
+            out = *cell & 0xFF;
+            advance();
+        }
+        panel.lowByte = !panel.lowByte;
+        break;
+    default:
+        break;
+    }
+    return out;
+}
+
+uint8_t sim_panelTransfer(bool data, uint8_t byte)
+{
+    if(data)
+    {
+        sim_dataBytes++;
+        return dataByte(byte);
+    }
+    sim_commandBytes++;
+    if(sim_commandCount < SIM_TRACE_SIZE)
+    {
+        sim_commandTrace[sim_commandCount] = byte;
+    }
+    sim_commandCount++;
+    panel.command = byte;
+    panel.argCount = 0;
+    panel.lowByte = false;
+    return 0xFF;
+}
+
+uint16_t sim_panelPixel(uint8_t x, uint8_t y)
+{
+    uint8_t row = (y + panel.startLine + SIM_GRAM_SIZE - SIM_BASE_START_LINE) % SIM_GRAM_SIZE;
+    return sim_gram[row][x + SIM_COLUMN_OFFSET];
+}
+
+void sim_panelSnapshot(uint16_t *pixels)
+{
+    uint8_t x, y;
+    for(y = 0; y < SIM_SCREEN_SIZE; y++)
+    {
+        for(x = 0; x < SIM_SCREEN_SIZE; x++)
+        {
+            *pixels++ = sim_panelPixel(x, y);
+        }
+    }
+}
+
+uint16_t sim_countDiff(const uint16_t *actual, const uint16_t *expected)
+{
+    uint16_t i, count = 0;
+    for(i = 0; i < SIM_SCREEN_SIZE * SIM_SCREEN_SIZE; i++)
+    {
+        if(actual[i] != expected[i] && count++ == 0)
+        {
+            printf("first mismatch at (%d, %d): 0x%04X, expected 0x%04X\n",
+                i % SIM_SCREEN_SIZE, i / SIM_SCREEN_SIZE, actual[i], expected[i]);
+        }
+    }
+    return count;
+}
+
+uint8_t sim_panelStartLine(void)
+{
+    return panel.startLine;
+}
+
+#define PPM_HEADER "P6\n96 96\n255\n"
+#define PPM_SIZE (sizeof(PPM_HEADER) - 1 + SIM_SCREEN_SIZE * SIM_SCREEN_SIZE * 3)
+
+static void encodePpm(uint8_t *out, const uint16_t *pixels)
+{
+    uint16_t i;
+    memcpy(out, PPM_HEADER, sizeof(PPM_HEADER) - 1);
+    out += sizeof(PPM_HEADER) - 1;
+    for(i = 0; i < SIM_SCREEN_SIZE * SIM_SCREEN_SIZE; i++)
+    {
+        uint16_t p = pixels[i];
+        *out++ = (p >> 11) * 255 / 31;
+        *out++ = ((p >> 5) & 0x3F) * 255 / 63;
+        *out++ = (p & 0x1F) * 255 / 31;
+    }
+}
+
+bool sim_writePpm(const char *path, const uint16_t *pixels)
+{
+    static uint8_t image[PPM_SIZE];
+    FILE *f = fopen(path, "wb");
+    if(!f)
+    {
+        return false;
+    }
+    encodePpm(image, pixels);
+    fwrite(image, 1, PPM_SIZE, f);
+    return fclose(f) == 0;
+}
+
+bool sim_ppmMatches(const char *path, const uint16_t *pixels)
+{
+    static uint8_t image[PPM_SIZE], golden[PPM_SIZE + 1];
+    size_t size;
+    FILE *f = fopen(path, "rb");
+    if(!f)
+    {
+        printf("%s: missing golden image\n", path);
+        return false;
+    }
+    size = fread(golden, 1, sizeof(golden), f);
+    fclose(f);
+    encodePpm(image, pixels);
+    return size == PPM_SIZE && memcmp(image, golden, PPM_SIZE) == 0;
+}
+
+static int readPpmField(FILE *f)
+{
+    int c, value = 0;
+    /* whitespace and comments up to the first digit */
+    while((c = fgetc(f)) == '#' || isspace(c))
+    {
+        if(c == '#')
+        {
+            while((c = fgetc(f)) != '\n' && c != EOF);
+        }
+    }
+    while(c >= '0' && c <= '9')
+    {
+        value = value * 10 + c - '0';
+        c = fgetc(f);
+    }
+    return value;
+}
+
+bool sim_readPpm(const char *path, uint16_t *pixels, uint16_t maxPixels, uint8_t *width, uint8_t *height)
+{
+    int w, h, i;
+    FILE *f = fopen(path, "rb");
+    if(!f)
+    {
+        return false;
+    }
+    if(fgetc(f) != 'P' || fgetc(f) != '6')
+    {
+        fclose(f);
+        return false;
+    }
+    w = readPpmField(f);
+    h = readPpmField(f);
+    if(readPpmField(f) != 255 || w > 0xFF || h > 0xFF || w * h > maxPixels)
+    {
+        fclose(f);
+        return false;
+    }
+    for(i = 0; i < w * h; i++)
+    {
+        uint8_t r = fgetc(f), g = fgetc(f), b = fgetc(f);
+        pixels[i] = (r >> 3) << 11 | (g >> 2) << 5 | b >> 3;
+    }
+    *width = w;
+    *height = h;
+    return fclose(f) == 0;
+}
@@ -0,0 +1,74 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef SIM_PANEL_H
+#define	SIM_PANEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Host model of the SSD1351 on the OLED C click: 128x128 GRAM, column and
+ * row windows, RAM write/read, the increment mode bit of the remap register
+ * and the display start line. Bytes arrive through the fake spi1 driver in
+ * sim/spi1_sim.c, which samples the DC and nCS pins. */
+
+#define SIM_GRAM_SIZE       128
+#define SIM_SCREEN_SIZE     96
+/* the 96 visible columns start at GRAM column 16 */
+#define SIM_COLUMN_OFFSET   16
+/* start line that shows GRAM row 0 at the top of the glass */
+#define SIM_BASE_START_LINE 0x20
+
+extern uint16_t sim_gram[SIM_GRAM_SIZE][SIM_GRAM_SIZE];
+/* bus traffic while nCS is low, and bytes clocked out with nCS high */
+extern uint32_t sim_commandBytes;
+extern uint32_t sim_dataBytes;
+extern uint32_t sim_strayBytes;
+/* pixels stored by RAM writes */
+extern uint32_t sim_pixelWrites;
+/* opcodes since the last count reset, the first SIM_TRACE_SIZE of them */
+#define SIM_TRACE_SIZE 64
+extern uint8_t sim_commandTrace[SIM_TRACE_SIZE];
+extern uint32_t sim_commandCount;
+/* column and row commands, and those that repeat the bounds and pointer
+ * already set since the last remap command */
+extern uint32_t sim_addressCommands;
+extern uint32_t sim_redundantAddressCommands;
+
+void sim_panelReset(uint16_t color);
+/* reset the model and bring the driver to the state oledC_setup leaves */
+void sim_panelStart(uint16_t color);
+uint8_t sim_panelTransfer(bool data, uint8_t byte);
+void sim_panelCountReset(void);
+/* pixel shown at visible (x, y), after the start line rotation */
+uint16_t sim_panelPixel(uint8_t x, uint8_t y);
+void sim_panelSnapshot(uint16_t *pixels);
+/* number of differing pixels between two snapshots, reporting the first */
+uint16_t sim_countDiff(const uint16_t *actual, const uint16_t *expected);
+uint8_t sim_panelStartLine(void);
+/* 96x96 binary PPM of a snapshot, and its comparison with a stored one */
+bool sim_writePpm(const char *path, const uint16_t *pixels);
+bool sim_ppmMatches(const char *path, const uint16_t *pixels);
+/* binary PPM of any size up to maxPixels, reduced to RGB565 */
+bool sim_readPpm(const char *path, uint16_t *pixels, uint16_t maxPixels, uint8_t *width, uint8_t *height);
+
+#endif	/* SIM_PANEL_H */
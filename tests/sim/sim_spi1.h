@@ -0,0 +1,49 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#ifndef SIM_SPI1_H
+#define	SIM_SPI1_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "../../spiDriver/spi1_driver.h"
+
+/* Test hooks of the fake spi1 driver in sim/spi1_sim.c. It implements
+ * spi1_driver.h on top of the panel model; DMA transfers reach the panel
+ * at once but only report done through spi1_dmaWait, spi1_dmaIsr or
+ * sim_spiDmaFinish, like a transfer still running in the background. */
+
+/* a block DMA cannot read, e.g. a const table in the PSV window */
+void sim_spiMapFlash(const void *block, size_t size);
+void sim_spiDmaFinish(void);
+bool sim_spiDmaPending(void);
+extern uint32_t sim_spiDmaTransfers;
+/* SPI1 register writes the real driver makes for the same CPU calls */
+extern uint32_t sim_spiSfrWrites;
+/* CPU cycles the driver spends on the bus under the shift clock model */
+extern uint32_t sim_spiCycles;
+void sim_spiTimingReset(void);
+/* mode a SPI1_WORD_FIFO open gets instead, to compare the session modes */
+void sim_spiSetWordMode(spi1_modes sessionMode);
+
+#endif	/* SIM_SPI1_H */
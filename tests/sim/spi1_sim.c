@@ -0,0 +1,325 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+#include <xc.h>
+#include "../../spiDriver/spi1_driver.h"
+#include "sim_spi1.h"
+#include "sim_panel.h"
+
+uint32_t sim_spiDmaTransfers;
+uint32_t sim_spiSfrWrites;
+uint32_t sim_spiCycles;
+
+static void (*interruptHandler)(void);
+static bool enabled;
+static spi1_modes mode;
+static spi1_modes wordMode = SPI1_WORD_FIFO;
+static bool dmaActive;
+static const uint8_t *flashBlock;
+static size_t flashSize;
+
+/* Shift clock model: sim_spiCycles is the CPU time spent in the driver.
+ * SCK runs at FCY / (2 * (SPI1BRGL + 1)); a frame starts when the shifter
+ * is free and the CPU may queue up to the buffer depth behind it: one frame
+ * in standard mode, 8 words of the 128-bit FIFO in enhanced mode. Cycle
+ * counts of the driver loops are rough PIC24 instruction counts. */
+#define CYCLES_CALL     8   /* call, return and loop setup */
+#define CYCLES_WORD     5   /* TX-full poll, buffer load and loop of a word */
+#define CYCLES_EXCHANGE 6   /* buffer load, RX-full poll exit and read of a byte */
+#define FIFO_WORDS      8
+
+static uint32_t frameDone[FIFO_WORDS + 1];
+static uint8_t framesQueued;
+
+static uint16_t frameCycles(uint8_t bits)
+{
+    return bits * 2 * (mode == SPI1_SLOW ? 16 : 1);
+}
+
+static void retireFrames(void)
+{
+    uint8_t i, kept = 0;
+    for(i = 0; i < framesQueued; i++)
+    {
+        if(frameDone[i] > sim_spiCycles)
+        {
+            frameDone[kept++] = frameDone[i];
+        }
+    }
+    framesQueued = kept;
+}
+
+/* the CPU loads one frame, first waiting for room in the buffer */
+static void queueFrame(uint8_t bits)
+{
+    uint8_t depth = mode == SPI1_WORD_FIFO ? FIFO_WORDS : 1;
+    uint32_t start;
+    retireFrames();
+    if(framesQueued > depth)
+    {
+        sim_spiCycles = frameDone[0];
+        retireFrames();
+    }
+    start = framesQueued ? frameDone[framesQueued - 1] : sim_spiCycles;
+    frameDone[framesQueued++] = start + frameCycles(bits);
+}
+
+/* waits until the last frame has left the shifter */
+static void drainFrames(void)
+{
+    if(framesQueued)
+    {
+        sim_spiCycles = frameDone[framesQueued - 1];
+        framesQueued = 0;
+    }
+}
+
+void sim_spiTimingReset(void)
+{
+    sim_spiCycles = 0;
+    framesQueued = 0;
+}
+
+void sim_spiSetWordMode(spi1_modes sessionMode)
+{
+    wordMode = sessionMode;
+}
+
+static uint8_t shift(uint8_t byte)
+{
+    if(!enabled)
+    {
+        return 0xFF;
+    }
+    if(LATCbits.LATC9)
+    {
+        sim_strayBytes++;
+        return 0xFF;
+    }
+    return sim_panelTransfer(LATCbits.LATC3, byte);
+}
+
+/* one SPI1BUFL write per byte, or per word in 16-bit mode */
+static uint8_t transfer(uint8_t byte)
+{
+    sim_spiSfrWrites++;
+    sim_spiCycles += CYCLES_EXCHANGE;
+    queueFrame(8);
+    drainFrames();
+    return shift(byte);
+}
+
+/* in 8-bit mode a word goes out as two byte exchanges, as before the
+ * 16-bit modes existed */
+static void transferWord(uint16_t word)
+{
+    if(mode == SPI1_DEFAULT || mode == SPI1_SLOW)
+    {
+        transfer(word >> 8);
+        transfer(word & 0xFF);
+        return;
+    }
+    sim_spiSfrWrites++;
+    sim_spiCycles += CYCLES_WORD;
+    queueFrame(16);
+    shift(word >> 8);
+    shift(word & 0xFF);
+}
+
+void spi1_close(void)
+{
+    sim_spiSfrWrites++; /* SPIEN */
+    enabled = false;
+}
+
+bool spi1_open(spi1_modes spiUniqueConfiguration)
+{
+    spi1_dmaWait();
+    if(enabled)
+    {
+        return false;
+    }
+    /* SPI1CON1L, SPI1CON1H, SPI1BRGL, TRISB15 and SPIEN */
+    sim_spiSfrWrites += 5;
+    sim_spiCycles += CYCLES_CALL;
+    mode = spiUniqueConfiguration == SPI1_WORD_FIFO ? wordMode : spiUniqueConfiguration;
+    enabled = true;
+    return true;
+}
+
+uint8_t spi1_exchangeByte(uint8_t b)
+{
+    return transfer(b);
+}
+
+void spi1_exchangeBlock(void *block, size_t blockSize)
+{
+    uint8_t *data = block;
+    sim_spiCycles += CYCLES_CALL;
+    while(blockSize--)
+    {
+        *data = transfer(*data);
+        data++;
+    }
+}
+
+void spi1_writeBlock(void *block, size_t blockSize)
+{
+    uint8_t *data = block;
+    sim_spiCycles += CYCLES_CALL;
+    while(blockSize--)
+    {
+        transfer(*data++);
+    }
+}
+
+void spi1_readBlock(void *block, size_t blockSize)
+{
+    uint8_t *data = block;
+    sim_spiCycles += CYCLES_CALL;
+    while(blockSize--)
+    {
+        *data++ = transfer(0);
+    }
+}
+
+void spi1_writeWords(const uint16_t *words, size_t count)
+{
+    sim_spiCycles += CYCLES_CALL;
+    while(count--)
+    {
+        transferWord(*words++);
+    }
+    drainFrames();
+}
+
+void spi1_writeWordRepeat(uint16_t word, size_t count)
+{
+    sim_spiCycles += CYCLES_CALL;
+    while(count--)
+    {
+        transferWord(word);
+    }
+    drainFrames();
+}
+
+void spi1_writeByte(uint8_t byte)
+{
+    transfer(byte);
+}
+
+uint8_t spi1_readByte(void)
+{
+    return 0xFF;
+}
+
+void spi1_isr(void)
+{
+}
+
+void spi1_setSpiISR(void(*handler)(void))
+{
+    interruptHandler = handler;
+}
+
+void (*spi1_getSpiISR(void))(void)
+{
+    return interruptHandler;
+}
+
+void sim_spiMapFlash(const void *block, size_t size)
+{
+    flashBlock = block;
+    flashSize = size;
+}
+
+bool spi1_dmaCanRead(const void *source, uint16_t count)
+{
+    const uint8_t *b = source;
+    return !flashBlock || b + 2 * count <= flashBlock || b >= flashBlock + flashSize;
+}
+
+static bool dmaStart(void)
+{
+    if(dmaActive)
+    {
+        return false;
+    }
+    spi1_close();
+    spi1_open(SPI1_WORD);
+    dmaActive = true;
+    sim_spiDmaTransfers++;
+    return true;
+}
+
+bool spi1_dmaWriteWords(const uint16_t *words, uint16_t count)
+{
+    if(count == 0 || !spi1_dmaCanRead(words, count) || !dmaStart())
+    {
+        return false;
+    }
+    spi1_writeWords(words, count);
+    return true;
+}
+
+bool spi1_dmaFillWords(uint16_t word, uint16_t count)
+{
+    if(count == 0 || !dmaStart())
+    {
+        return false;
+    }
+    spi1_writeWordRepeat(word, count);
+    return true;
+}
+
+bool sim_spiDmaPending(void)
+{
+    return dmaActive;
+}
+
+void sim_spiDmaFinish(void)
+{
+    if(dmaActive)
+    {
+        spi1_close();
+        dmaActive = false;
+        if(interruptHandler)
+        {
+            interruptHandler();
+        }
+    }
+}
+
+bool spi1_dmaBusy(void)
+{
+    return dmaActive;
+}
+
+void spi1_dmaWait(void)
+{
+    sim_spiDmaFinish();
+}
+
+void spi1_dmaIsr(void)
+{
+    sim_spiDmaFinish();
+}
@@ -0,0 +1,303 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Host stand-in for the XC16 device header: only the SFRs the driver code
+ * touches, laid out like the PIC24FJ256GA705 so that whole-register writes
+ * and bit-field writes see each other. */
+
+#ifndef XC_H
+#define	XC_H
+
+#include <stdint.h>
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned ENHBUF:1;
+        unsigned SPIFE:1;
+        unsigned MCLKEN:1;
+        unsigned DISSCK:1;
+        unsigned DISSDI:1;
+        unsigned MSTEN:1;
+        unsigned CKP:1;
+        unsigned SSEN:1;
+        unsigned CKE:1;
+        unsigned SMP:1;
+        unsigned MODE16:1;
+        unsigned MODE32:1;
+        unsigned DISSDO:1;
+        unsigned SPISIDL:1;
+        unsigned :1;
+        unsigned SPIEN:1;
+    } bits;
+} SPI1CON1L_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned SPIRBF:1;
+        unsigned SPITBF:1;
+        unsigned :1;
+        unsigned SPITBE:1;
+        unsigned :1;
+        unsigned SPIRBE:1;
+        unsigned SPIROV:1;
+        unsigned SRMT:1;
+        unsigned SPITUR:1;
+        unsigned :2;
+        unsigned SPIBUSY:1;
+        unsigned FRMERR:1;
+        unsigned :3;
+    } bits;
+} SPI1STATL_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned :15;
+        unsigned DMAEN:1;
+    } bits;
+} DMACON_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned CHEN:1;
+        unsigned SIZE:1;
+        unsigned TRMODE:2;
+        unsigned DAMODE:2;
+        unsigned SAMODE:2;
+        unsigned CHREQ:1;
+        unsigned RELOAD:1;
+        unsigned NULLW:1;
+        unsigned :5;
+    } bits;
+} DMACH0_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned :1;
+        unsigned HALFEN:1;
+        unsigned LOWIF:1;
+        unsigned HIGHIF:1;
+        unsigned OVRUNIF:1;
+        unsigned DONEIF:1;
+        unsigned HALFIF:1;
+        unsigned DBUFWF:1;
+        unsigned CHSEL:7;
+        unsigned :1;
+    } bits;
+} DMAINT0_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned INT0IF:1;
+        unsigned IC1IF:1;
+        unsigned OC1IF:1;
+        unsigned T1IF:1;
+        unsigned DMA0IF:1;
+        unsigned IC2IF:1;
+        unsigned OC2IF:1;
+        unsigned T2IF:1;
+        unsigned T3IF:1;
+        unsigned :7;
+    } bits;
+} IFS0_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned INT0IE:1;
+        unsigned IC1IE:1;
+        unsigned OC1IE:1;
+        unsigned T1IE:1;
+        unsigned DMA0IE:1;
+        unsigned IC2IE:1;
+        unsigned OC2IE:1;
+        unsigned T2IE:1;
+        unsigned T3IE:1;
+        unsigned :7;
+    } bits;
+} IEC0_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned :8;
+        unsigned SPI1RXIF:1;
+        unsigned SPI1TXIF:1;
+        unsigned SPI1IF:1;
+        unsigned :5;
+    } bits;
+} IFS3_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned :1;
+        unsigned TCS:1;
+        unsigned :1;
+        unsigned T32:1;
+        unsigned TCKPS:2;
+        unsigned TGATE:1;
+        unsigned :8;
+        unsigned TON:1;
+    } bits;
+} TCON_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned INT0IP:3;
+        unsigned :1;
+        unsigned IC1IP:3;
+        unsigned :1;
+        unsigned OC1IP:3;
+        unsigned :1;
+        unsigned T1IP:3;
+        unsigned :1;
+    } bits;
+} IPC0_t;
+
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        unsigned R0:1;
+        unsigned R1:1;
+        unsigned R2:1;
+        unsigned R3:1;
+        unsigned R4:1;
+        unsigned R5:1;
+        unsigned R6:1;
+        unsigned R7:1;
+        unsigned R8:1;
+        unsigned R9:1;
+        unsigned R10:1;
+        unsigned R11:1;
+        unsigned R12:1;
+        unsigned R13:1;
+        unsigned R14:1;
+        unsigned R15:1;
+    } bits;
+} PORT_t;
+
+extern volatile SPI1CON1L_t sfr_SPI1CON1L;
+extern volatile SPI1STATL_t sfr_SPI1STATL;
+extern volatile DMACON_t sfr_DMACON;
+extern volatile DMACH0_t sfr_DMACH0;
+extern volatile DMAINT0_t sfr_DMAINT0;
+extern volatile IFS0_t sfr_IFS0;
+extern volatile IEC0_t sfr_IEC0;
+extern volatile IFS3_t sfr_IFS3;
+extern volatile TCON_t sfr_T1CON;
+extern volatile TCON_t sfr_T2CON;
+extern volatile IPC0_t sfr_IPC0;
+extern volatile PORT_t sfr_TRISB;
+extern volatile PORT_t sfr_LATA;
+extern volatile PORT_t sfr_LATB;
+extern volatile PORT_t sfr_LATC;
+extern volatile PORT_t sfr_PORTA;
+extern volatile uint16_t SPI1CON1H;
+extern volatile uint16_t SPI1BRGL;
+extern volatile uint16_t SPI1BUFL;
+extern volatile uint16_t DMAL;
+extern volatile uint16_t DMAH;
+extern volatile uint16_t DMASRC0;
+extern volatile uint16_t DMADST0;
+extern volatile uint16_t DMACNT0;
+extern volatile uint16_t PR1;
+extern volatile uint16_t TMR1;
+extern volatile uint16_t PR2;
+extern volatile uint16_t TMR2;
+
+#define SPI1CON1L       sfr_SPI1CON1L.reg
+#define SPI1CON1Lbits   sfr_SPI1CON1L.bits
+#define SPI1STATL       sfr_SPI1STATL.reg
+#define SPI1STATLbits   sfr_SPI1STATL.bits
+#define DMACON          sfr_DMACON.reg
+#define DMACONbits      sfr_DMACON.bits
+#define DMACH0          sfr_DMACH0.reg
+#define DMACH0bits      sfr_DMACH0.bits
+#define DMAINT0         sfr_DMAINT0.reg
+#define DMAINT0bits     sfr_DMAINT0.bits
+#define IFS0            sfr_IFS0.reg
+#define IFS0bits        sfr_IFS0.bits
+#define IEC0            sfr_IEC0.reg
+#define IEC0bits        sfr_IEC0.bits
+#define IFS3            sfr_IFS3.reg
+#define IFS3bits        sfr_IFS3.bits
+#define T1CON           sfr_T1CON.reg
+#define T1CONbits       sfr_T1CON.bits
+#define T2CON           sfr_T2CON.reg
+#define T2CONbits       sfr_T2CON.bits
+#define IPC0            sfr_IPC0.reg
+#define IPC0bits        sfr_IPC0.bits
+#define TRISB           sfr_TRISB.reg
+#define LATA            sfr_LATA.reg
+#define LATB            sfr_LATB.reg
+#define LATC            sfr_LATC.reg
+#define PORTA           sfr_PORTA.reg
+
+/* the port bit names the drivers use, mapped onto the generic layout */
+#define TRISBbits       sfr_TRISB.bits
+#define TRISB15         R15
+#define LATAbits        sfr_LATA.bits
+#define LATA13          R13
+#define LATCbits        sfr_LATC.bits
+#define LATC1           R1
+#define LATC3           R3
+#define LATC8           R8
+#define LATC9           R9
+#define PORTAbits       sfr_PORTA.bits
+#define RA11            R11
+#define _LATA13         LATAbits.LATA13
+#define _LATB13         sfr_LATB.bits.R13
+#define _LATB14         sfr_LATB.bits.R14
+
+#define Nop()           ((void)0)
+#define ClrWdt()        ((void)0)
+
+#endif	/* XC_H */
@@ -0,0 +1,95 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Arc sweeps on the panel model: angle pairs a whole turn apart draw the
+ * full ring, equal angles draw nothing, and rings larger than a uint8_t
+ * radius do not wrap around to small ones */
+
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+int check_failures;
+
+static uint16_t ring[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE];
+static uint16_t blank[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE];
+static uint16_t arc[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE];
+
+static void checkArc(uint16_t start, uint16_t end, const uint16_t *expected)
+{
+    sim_panelStart(0);
+    oledC_DrawArc(48, 48, 30, 6, start, end, 0xFFFF);
+    sim_panelSnapshot(arc);
+    if(sim_countDiff(arc, expected) != 0)
+    {
+        printf("arc %u..%u\n", start, end);
+        check_failures++;
+    }
+}
+
+static void testFullTurns(void)
+{
+    sim_panelStart(0);
+    sim_panelSnapshot(blank);
+    oledC_DrawRing(48, 48, 30, 6, 0xFFFF);
+    sim_panelSnapshot(ring);
+    CHECK_EQ(sim_panelPixel(48, 18), 0xFFFF);
+
+    checkArc(0, 360, ring);
+    checkArc(360, 0, ring);
+    checkArc(90, 450, ring);
+    checkArc(400, 40, ring);
+    checkArc(10, 1000, ring);
+    checkArc(65530, 10, ring);
+    checkArc(45, 45, blank);
+    checkArc(360, 360, blank);
+}
+
+/* two arcs meeting at 90 degrees cover the ring */
+static void testHalves(void)
+{
+    sim_panelStart(0);
+    oledC_DrawArc(48, 48, 30, 6, 0, 90, 0xFFFF);
+    oledC_DrawArc(48, 48, 30, 6, 90, 360, 0xFFFF);
+    sim_panelSnapshot(arc);
+    CHECK_EQ(sim_countDiff(arc, ring), 0);
+}
+
+/* radius + width / 2 beyond 255 used to wrap to a small disc */
+static void testLargeRadius(void)
+{
+    sim_panelStart(0);
+    oledC_DrawRing(48, 48, 200, 120, 0xFFFF);
+    oledC_DrawArc(48, 48, 200, 120, 0, 180, 0xFFFF);
+    sim_panelSnapshot(arc);
+    CHECK_EQ(sim_countDiff(arc, blank), 0);
+    CHECK_EQ(sim_strayBytes, 0);
+}
+
+int main(void)
+{
+    testFullTurns();
+    testHalves();
+    testLargeRadius();
+    return CHECK_DONE();
+}
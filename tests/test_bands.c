@@ -0,0 +1,129 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Band rendering: the banded frame equals a direct redraw, also when called
+ * from inside a viewport, and each band only rasterizes the shapes that
+ * reach its rows. A full viewport stack fails the render before anything
+ * is sent. Built with bands enabled; the fill sinks are wrapped
+ * (-Wl,--wrap) to count the work. */
+
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapeHandler.h"
+#include "../oledDriver/oledC_framebuffer.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+int check_failures;
+
+static uint16_t direct[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE];
+static uint16_t banded[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE];
+static uint32_t bandFills, fbFills;
+
+void __real_oledC_bandFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+void __real_oledC_fbFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+
+void __wrap_oledC_bandFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    bandFills++;
+    __real_oledC_bandFillRect(start_x, start_y, end_x, end_y, color);
+}
+
+void __wrap_oledC_fbFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    fbFills++;
+    __real_oledC_fbFillRect(start_x, start_y, end_x, end_y, color);
+}
+
+static void buildScene(void)
+{
+    shape_params_t p;
+    static uint8_t text[] = "12:34";
+
+    initShapesMem();
+    p.rectangle.color = 0x001F;
+    p.rectangle.xs = 4; p.rectangle.ys = 60; p.rectangle.xe = 90; p.rectangle.ye = 92;
+    oledC_insertShape(OLED_SHAPE_RECTANGLE, &p, OLEDC_SHAPE_NONE);
+    p.circle.color = 0xF800;
+    p.circle.xc = 30; p.circle.yc = 30; p.circle.radius = 20;
+    oledC_insertShape(OLED_SHAPE_CIRCLE, &p, OLEDC_SHAPE_NONE);
+    p.ring.color = 0x07E0;
+    p.ring.x0 = 70; p.ring.y0 = 24; p.ring.radius = 14; p.ring.width = 4;
+    oledC_insertShape(OLED_SHAPE_RING, &p, OLEDC_SHAPE_NONE);
+    p.line.color = 0xFFE0;
+    p.line.xs = 2; p.line.ys = 94; p.line.xe = 93; p.line.ye = 3; p.line.width = 3;
+    oledC_insertShape(OLED_SHAPE_LINE, &p, OLEDC_SHAPE_NONE);
+    p.string.color = 0xFFFF;
+    p.string.x = 10; p.string.y = 66; p.string.scale_x = 2; p.string.scale_y = 2;
+    p.string.string = text;
+    oledC_insertShape(OLED_SHAPE_STRING, &p, OLEDC_SHAPE_NONE);
+}
+
+int main(void)
+{
+    uint8_t i;
+    buildScene();
+
+    sim_panelStart(0x0000);
+    oledC_setDrawTarget(OLEDC_TARGET_PANEL);
+    oledC_redrawAll();
+    sim_panelSnapshot(direct);
+
+    sim_panelStart(0xFFFF);
+    bandFills = 0;
+    CHECK(oledC_renderAllBanded(0x0000));
+    sim_panelSnapshot(banded);
+    sim_writePpm("build/bands.ppm", banded);
+    CHECK_EQ(sim_countDiff(banded, direct), 0);
+    CHECK(oledC_getDrawTarget() == OLEDC_TARGET_PANEL);
+
+    /* the same scene drawn once into the framebuffer is the unbanded cost;
+     * every band adds its background fill and the spans split at band edges */
+    oledC_setDrawTarget(OLEDC_TARGET_FRAMEBUFFER);
+    fbFills = 0;
+    oledC_redrawAll();
+    oledC_setDrawTarget(OLEDC_TARGET_PANEL);
+    printf("band fills %u, single pass fills %u\n", (unsigned)bandFills, (unsigned)fbFills);
+    CHECK(bandFills <= fbFills + 2 * SIM_SCREEN_SIZE / OLEDC_BAND_HEIGHT + 40);
+
+    /* the bands cover the screen, not the caller's viewport */
+    sim_panelStart(0xFFFF);
+    CHECK(oledC_pushViewport(20, 30, 40, 20));
+    CHECK(oledC_renderAllBanded(0x0000));
+    oledC_popViewport();
+    sim_panelSnapshot(banded);
+    CHECK_EQ(sim_countDiff(banded, direct), 0);
+
+    /* no room for the band clip: nothing reaches the panel */
+    sim_panelStart(0xFFFF);
+    for(i = 0; i < OLEDC_VIEWPORT_DEPTH; i++)
+    {
+        CHECK(oledC_pushClip(0, 0, 96, 96));
+    }
+    CHECK(!oledC_renderAllBanded(0x0000));
+    CHECK_EQ(sim_commandBytes + sim_dataBytes, 0);
+    CHECK(oledC_getDrawTarget() == OLEDC_TARGET_PANEL);
+    oledC_resetViewport();
+    CHECK(oledC_renderAllBanded(0x0000));
+    sim_panelSnapshot(banded);
+    CHECK_EQ(sim_countDiff(banded, direct), 0);
+    return CHECK_DONE();
+}
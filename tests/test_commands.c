@@ -0,0 +1,186 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Command trace of the address shadow in oledC.c: column / row commands
+ * that would not move the window or the GRAM pointer are dropped, the
+ * shadow is forgotten when oledC_setVerticalIncrement changes the remap,
+ * and a watch face frame sends no redundant address command. Built a
+ * second time with OLEDC_ADDRESS_SHADOW=0, it reports the commands the
+ * shadow saves per frame instead. */
+
+#define main watchMain
+#include "../main.c"
+#undef main
+
+#include <stdio.h>
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define TICKS 600
+
+int check_failures;
+
+void SYSTEM_Initialize(void)
+{
+}
+
+#if OLEDC_ADDRESS_SHADOW
+static bool traceIs(const uint8_t *opcodes, uint8_t count)
+{
+    uint8_t i;
+    if(sim_commandCount != count)
+    {
+        printf("%lu commands, expected %d\n", (unsigned long)sim_commandCount, count);
+        return false;
+    }
+    for(i = 0; i < count; i++)
+    {
+        if(sim_commandTrace[i] != opcodes[i])
+        {
+            printf("command %d is 0x%02X, expected 0x%02X\n", i, sim_commandTrace[i], opcodes[i]);
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static void testBounds(void)
+{
+#if OLEDC_ADDRESS_SHADOW
+    static const uint8_t column[] = { 0x15 }, row[] = { 0x75 };
+    sim_panelStart(0);
+    oledC_setColumnAddressBounds(10, 20);
+    oledC_setColumnAddressBounds(10, 20);
+    CHECK(traceIs(column, 1));
+
+    sim_panelCountReset();
+    oledC_setRowAddressBounds(30, 40);
+    oledC_setRowAddressBounds(30, 40);
+    CHECK(traceIs(row, 1));
+    /* the same bounds again once the pointer moved must be sent */
+    oledC_sendColorInt(0x1234);
+    oledC_setColumnAddressBounds(10, 20);
+    CHECK_EQ(sim_addressCommands, 2);
+    CHECK_EQ(sim_redundantAddressCommands, 0);
+#else
+    sim_panelStart(0);
+    oledC_setColumnAddressBounds(10, 20);
+    oledC_setColumnAddressBounds(10, 20);
+    CHECK_EQ(sim_addressCommands, 2);
+    CHECK_EQ(sim_redundantAddressCommands, 1);
+#endif
+}
+
+static void testPixelAddress(void)
+{
+#if OLEDC_ADDRESS_SHADOW
+    static const uint8_t both[] = { 0x15, 0x75 }, rowOnly[] = { 0x75 };
+    sim_panelStart(0);
+    oledC_setPixelAddress(30, 40);
+    oledC_setPixelAddress(30, 40);
+    CHECK(traceIs(both, 2));
+
+    /* the pointer follows the pixels written, so the next pixel of the
+     * row needs no command */
+    oledC_sendColorInt(0x1234);
+    sim_panelCountReset();
+    oledC_setPixelAddress(31, 40);
+    CHECK_EQ(sim_addressCommands, 0);
+    oledC_sendColorInt(0x4321);
+    CHECK_EQ(sim_panelPixel(30, 40), 0x1234);
+    CHECK_EQ(sim_panelPixel(31, 40), 0x4321);
+
+    /* the open-ended window stays, only the row moves */
+    sim_panelCountReset();
+    oledC_setPixelAddress(32, 41);
+    CHECK(traceIs(rowOnly, 1));
+    CHECK_EQ(sim_redundantAddressCommands, 0);
+#endif
+}
+
+static void testVerticalIncrement(void)
+{
+#if OLEDC_ADDRESS_SHADOW
+    static const uint8_t remap[] = { 0xA0 }, resent[] = { 0x15, 0x75 };
+    sim_panelStart(0);
+    oledC_setPixelAddress(5, 6);
+    sim_panelCountReset();
+    oledC_setVerticalIncrement(true);
+    CHECK(traceIs(remap, 1));
+
+    /* the driver's pointer tracking changes with the increment mode */
+    sim_panelCountReset();
+    oledC_setPixelAddress(5, 6);
+    CHECK(traceIs(resent, 2));
+
+    /* no change, no remap command and the shadow survives */
+    sim_panelCountReset();
+    oledC_setVerticalIncrement(true);
+    oledC_setPixelAddress(5, 6);
+    CHECK_EQ(sim_commandCount, 0);
+
+    sim_panelCountReset();
+    oledC_setVerticalIncrement(false);
+    oledC_setPixelAddress(5, 6);
+    CHECK_EQ(sim_commandCount, 3);
+    CHECK_EQ(sim_addressCommands, 2);
+    CHECK_EQ(sim_redundantAddressCommands, 0);
+#endif
+}
+
+static void testWatchFace(void)
+{
+    uint32_t commands = 0, address = 0, redundant = 0;
+    uint16_t tick;
+
+    sim_panelStart(OLEDC_COLOR_BLACK);
+    SetupWatchFace();
+    DrawTimeDate();
+    for(tick = 0; tick < TICKS; tick++)
+    {
+        sim_panelCountReset();
+        IncrementTime();
+        DrawTimeDate();
+        commands += sim_commandCount;
+        address += sim_addressCommands;
+        redundant += sim_redundantAddressCommands;
+    }
+    printf("test_commands: %d watch face frames, address shadow %s, per frame\n",
+           TICKS, OLEDC_ADDRESS_SHADOW ? "on" : "off");
+    printf("  %6.2f commands %6.2f column / row %6.2f redundant\n",
+           (double)commands / TICKS, (double)address / TICKS, (double)redundant / TICKS);
+#if OLEDC_ADDRESS_SHADOW
+    CHECK_EQ(redundant, 0);
+#else
+    printf("  the shadow saves %.2f commands per frame\n", (double)redundant / TICKS);
+#endif
+}
+
+int main(void)
+{
+    testBounds();
+    testPixelAddress();
+    testVerticalIncrement();
+    testWatchFace();
+    return CHECK_DONE();
+}
@@ -0,0 +1,222 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Compositor: after every scene edit, oledC_composite() must leave the
+ * panel exactly as a full repaint of the scene would. The reference clears
+ * to the background and draws every visible shape bottom to top from its
+ * decoded params, without damage tracking or culling. */
+
+#include <string.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapeHandler.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define STEPS 600
+
+int check_failures;
+
+static uint16_t composited[SIZE * SIZE];
+static uint16_t reference[SIZE * SIZE];
+static bool visible[OLEDC_MAX_SHAPES];
+static oledC_shapeHandle_t live[OLEDC_MAX_SHAPES];
+static uint8_t liveCount;
+static uint16_t background;
+static uint32_t seed = 12345;
+
+static uint16_t randomBelow(uint16_t limit)
+{
+    seed = seed * 1103515245UL + 12345UL;
+    return (uint16_t)((seed >> 16) % limit);
+}
+
+/* a few more colours than the palette holds */
+static uint16_t randomColor(void)
+{
+    static const uint16_t colors[] = {
+        0xF800, 0x07E0, 0x001F, 0xFFE0, 0xF81F, 0x07FF, 0xFFFF, 0x8410,
+        0xFC00, 0x0410, 0x8000, 0x0010, 0x4208, 0xC618, 0x2945, 0xFBE0,
+        0x7BEF, 0x03E0, 0x8010, 0xA145,
+    };
+    return colors[randomBelow(sizeof(colors) / sizeof(colors[0]))];
+}
+
+/* coordinates reach past the glass to exercise the clipping */
+static uint8_t randomCoordinate(void)
+{
+    return randomBelow(110);
+}
+
+static enum OLEDC_SHAPE randomShape(shape_params_t *p)
+{
+    static uint8_t texts[3][6] = {"12:34", "A", "ok!"};
+    memset(p, 0, sizeof(*p));
+    p->point.color = randomColor();
+    switch(randomBelow(7))
+    {
+        case 0:
+            p->rectangle.xs = randomCoordinate();
+            p->rectangle.ys = randomCoordinate();
+            p->rectangle.xe = p->rectangle.xs + randomBelow(50);
+            p->rectangle.ye = p->rectangle.ys + randomBelow(50);
+            return OLED_SHAPE_RECTANGLE;
+        case 1:
+            p->circle.xc = randomCoordinate();
+            p->circle.yc = randomCoordinate();
+            p->circle.radius = randomBelow(30);
+            return OLED_SHAPE_CIRCLE;
+        case 2:
+            p->ring.x0 = randomCoordinate();
+            p->ring.y0 = randomCoordinate();
+            p->ring.radius = 2 + randomBelow(25);
+            p->ring.width = 1 + randomBelow(6);
+            return OLED_SHAPE_RING;
+        case 3:
+            p->line.xs = randomCoordinate();
+            p->line.ys = randomCoordinate();
+            p->line.xe = randomCoordinate();
+            p->line.ye = randomCoordinate();
+            p->line.width = 1 + randomBelow(4);
+            return OLED_SHAPE_LINE;
+        case 4:
+            p->character.x = randomCoordinate();
+            p->character.y = randomCoordinate();
+            p->character.scale_x = 1 + randomBelow(3);
+            p->character.scale_y = 1 + randomBelow(3);
+            p->character.character = '0' + randomBelow(10);
+            return OLED_SHAPE_CHARACTER;
+        case 5:
+            p->string.x = randomCoordinate();
+            p->string.y = randomCoordinate();
+            p->string.scale_x = 1 + randomBelow(2);
+            p->string.scale_y = 1 + randomBelow(2);
+            p->string.string = texts[randomBelow(3)];
+            return OLED_SHAPE_STRING;
+        default:
+            p->point.x = randomCoordinate();
+            p->point.y = randomCoordinate();
+            return OLED_SHAPE_POINT;
+    }
+}
+
+static void removeLive(uint8_t index)
+{
+    live[index] = live[--liveCount];
+}
+
+/* one random edit of the scene; returns a name for the report */
+static const char *randomEdit(void)
+{
+    shape_params_t p;
+    enum OLEDC_SHAPE type, current;
+    oledC_shapeHandle_t handle, before;
+    uint8_t index = liveCount ? randomBelow(liveCount) : 0;
+    uint8_t edit = liveCount < 4 ? 0 : randomBelow(liveCount < OLEDC_MAX_SHAPES ? 7 : 6) + 1;
+
+    handle = liveCount ? live[index] : OLEDC_SHAPE_NONE;
+    before = liveCount && randomBelow(2) ? live[randomBelow(liveCount)] : OLEDC_SHAPE_NONE;
+    switch(edit)
+    {
+        case 1:
+            oledC_deleteShape(handle);
+            removeLive(index);
+            return "delete";
+        case 2:
+            oledC_moveShape(handle, before);
+            return "move";
+        case 3:
+            /* same type, new geometry and colour */
+            oledC_getShapeParams(handle, &current, &p);
+            do
+            {
+                type = randomShape(&p);
+            }
+            while(type != current);
+            oledC_updateShape(handle, &p);
+            return "update";
+        case 4:
+            visible[handle] = !visible[handle];
+            oledC_setShapeVisible(handle, visible[handle]);
+            return "visibility";
+        case 5:
+            if(randomBelow(4) == 0)
+            {
+                background = randomColor();
+                oledC_setBackground(background);
+                return "background";
+            }
+            /* fall through */
+        default:
+            type = randomShape(&p);
+            handle = oledC_insertShape(type, &p, before);
+            if(handle == OLEDC_SHAPE_NONE)
+            {
+                return "insert (full)";
+            }
+            visible[handle] = true;
+            live[liveCount++] = handle;
+            return "insert";
+    }
+}
+
+static void drawReference(void)
+{
+    shape_params_t p;
+    enum OLEDC_SHAPE type;
+    oledC_shapeHandle_t handle;
+    oledC_clear(background);
+    for(handle = oledC_firstShape(); handle != OLEDC_SHAPE_NONE; handle = oledC_nextShape(handle))
+    {
+        if(visible[handle] && oledC_getShapeParams(handle, &type, &p))
+        {
+            oledC_drawShape(type, &p);
+        }
+    }
+}
+
+int main(void)
+{
+    uint16_t step, failed = 0;
+    const char *edit;
+
+    sim_panelStart(0);
+    initShapesMem();
+    oledC_setBackground(background);
+    for(step = 0; step < STEPS && failed < 3; step++)
+    {
+        edit = randomEdit();
+        oledC_composite();
+        CHECK(!oledC_sceneDirty());
+        sim_panelSnapshot(composited);
+        drawReference();
+        sim_panelSnapshot(reference);
+        if(sim_countDiff(composited, reference) != 0)
+        {
+            printf("step %u (%s, %u shapes) differs from a full repaint\n", step, edit, liveCount);
+            check_failures++;
+            failed++;
+        }
+    }
+    CHECK_EQ(sim_strayBytes, 0);
+    return CHECK_DONE();
+}
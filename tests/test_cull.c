@@ -0,0 +1,240 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Occlusion culling in redraw passes: bounding box trims and skips are
+ * checked case by case, every culled redraw must match a plain bottom to top
+ * redraw pixel for pixel, and a layered panel scene reports what culling
+ * saves on the bus. */
+
+#include <string.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapeHandler.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+
+int check_failures;
+
+static uint16_t culled[SIZE * SIZE];
+static uint16_t plain[SIZE * SIZE];
+static uint32_t culledBytes, plainBytes;
+
+static oledC_shapeHandle_t addRect(uint8_t xs, uint8_t ys, uint8_t xe, uint8_t ye, uint16_t color)
+{
+    shape_params_t p;
+    p.rectangle.color = color;
+    p.rectangle.xs = xs;
+    p.rectangle.ys = ys;
+    p.rectangle.xe = xe;
+    p.rectangle.ye = ye;
+    return oledC_insertShape(OLED_SHAPE_RECTANGLE, &p, OLEDC_SHAPE_NONE);
+}
+
+static oledC_shapeHandle_t addCircle(uint8_t xc, uint8_t yc, uint8_t radius, uint16_t color)
+{
+    shape_params_t p;
+    p.circle.color = color;
+    p.circle.xc = xc;
+    p.circle.yc = yc;
+    p.circle.radius = radius;
+    return oledC_insertShape(OLED_SHAPE_CIRCLE, &p, OLEDC_SHAPE_NONE);
+}
+
+static oledC_shapeHandle_t addText(uint8_t x, uint8_t y, const char *text, uint16_t color)
+{
+    static uint8_t buffer[16];
+    shape_params_t p;
+    strncpy((char*)buffer, text, sizeof(buffer) - 1);
+    p.string.color = color;
+    p.string.x = x;
+    p.string.y = y;
+    p.string.scale_x = 1;
+    p.string.scale_y = 1;
+    p.string.string = buffer;
+    return oledC_insertShape(OLED_SHAPE_STRING, &p, OLEDC_SHAPE_NONE);
+}
+
+/* Redraws the scene with culling and without; returns the cull stats */
+static oledC_cullStats_t redrawBoth(bool *hidden)
+{
+    oledC_cullStats_t stats;
+    oledC_shapeHandle_t handle;
+    enum OLEDC_SHAPE type;
+    shape_params_t p;
+
+    sim_panelStart(0);
+    sim_panelCountReset();
+    oledC_cullStatsReset();
+    oledC_redrawAll();
+    stats = *oledC_cullStats();
+    culledBytes = sim_dataBytes + sim_commandBytes;
+    sim_panelSnapshot(culled);
+
+    sim_panelStart(0);
+    sim_panelCountReset();
+    for(handle = oledC_firstShape(); handle != OLEDC_SHAPE_NONE; handle = oledC_nextShape(handle))
+    {
+        if(!(hidden && hidden[handle]) && oledC_getShapeParams(handle, &type, &p))
+        {
+            oledC_drawShape(type, &p);
+        }
+    }
+    plainBytes = sim_dataBytes + sim_commandBytes;
+    sim_panelSnapshot(plain);
+    CHECK_EQ(sim_countDiff(culled, plain), 0);
+    return stats;
+}
+
+/* a circle fully under a rectangle is not drawn at all */
+static void testHidden(void)
+{
+    oledC_cullStats_t stats;
+    initShapesMem();
+    addCircle(30, 30, 10, 0xF800);
+    addRect(10, 10, 60, 60, 0x001F);
+    stats = redrawBoth(NULL);
+    CHECK_EQ(stats.shapesSkipped, 1);
+    CHECK_EQ(stats.pixelsSkipped, 21 * 21);
+    CHECK(culledBytes < plainBytes);
+}
+
+/* an occluder over a full edge strip clips that strip away */
+static void testEdgeTrim(void)
+{
+    oledC_cullStats_t stats;
+    initShapesMem();
+    addRect(0, 0, 40, 40, 0xF800);
+    addRect(20, 0, 60, 40, 0x001F);
+    stats = redrawBoth(NULL);
+    CHECK_EQ(stats.shapesSkipped, 0);
+    CHECK_EQ(stats.pixelsSkipped, 21 * 41);
+
+    initShapesMem();
+    addRect(0, 0, 40, 40, 0xF800);
+    addRect(0, 30, 40, 50, 0x001F);
+    stats = redrawBoth(NULL);
+    CHECK_EQ(stats.pixelsSkipped, 11 * 41);
+}
+
+/* a strip through the middle, or a corner, cannot be clipped by one
+ * rectangle: the shape is drawn whole */
+static void testNoTrim(void)
+{
+    oledC_cullStats_t stats;
+    initShapesMem();
+    addRect(0, 0, 40, 40, 0xF800);
+    addRect(10, 0, 20, 40, 0x001F);
+    addRect(30, 30, 60, 60, 0x07E0);
+    stats = redrawBoth(NULL);
+    CHECK_EQ(stats.shapesSkipped, 0);
+    CHECK_EQ(stats.pixelsSkipped, 0);
+}
+
+/* two occluders that only hide the shape together */
+static void testCombined(void)
+{
+    oledC_cullStats_t stats;
+    initShapesMem();
+    addCircle(30, 30, 20, 0xF800);
+    addRect(0, 0, 30, 60, 0x001F);
+    addRect(25, 0, 60, 60, 0x07E0);
+    stats = redrawBoth(NULL);
+    CHECK_EQ(stats.shapesSkipped, 1);
+    /* the circle, and the strip of the first rectangle under the second */
+    CHECK_EQ(stats.pixelsSkipped, 41 * 41 + 6 * 61);
+}
+
+/* a filled circle occludes with its inscribed square */
+static void testCircleOccluder(void)
+{
+    oledC_cullStats_t stats;
+    initShapesMem();
+    addRect(44, 44, 52, 52, 0xF800);
+    addRect(40, 20, 56, 30, 0x07E0);
+    addCircle(48, 48, 20, 0x001F);
+    stats = redrawBoth(NULL);
+    CHECK_EQ(stats.shapesSkipped, 1);
+    CHECK_EQ(stats.pixelsSkipped, 9 * 9);
+}
+
+/* hidden shapes do not occlude, and nothing below a shape culls it */
+static void testNoOccluder(void)
+{
+    oledC_cullStats_t stats;
+    bool hidden[OLEDC_MAX_SHAPES] = {false};
+    oledC_shapeHandle_t cover;
+    initShapesMem();
+    addRect(0, 0, 95, 95, 0x001F);
+    addCircle(30, 30, 10, 0xF800);
+    cover = addRect(10, 10, 60, 60, 0x07E0);
+    oledC_setShapeVisible(cover, false);
+    hidden[cover] = true;
+    stats = redrawBoth(hidden);
+    CHECK_EQ(stats.shapesSkipped, 0);
+    CHECK_EQ(stats.pixelsSkipped, 0);
+}
+
+/* Benchmark: a full screen backdrop, three overlapping panels with their
+ * content and a status bar on top */
+static void testLayeredPanels(void)
+{
+    oledC_cullStats_t stats;
+    initShapesMem();
+    addRect(0, 0, 95, 95, 0x2945);
+    addCircle(24, 34, 10, 0x8410);
+    addText(12, 80, "backdrop", 0xFFFF);
+
+    addRect(4, 10, 60, 60, 0x001F);
+    addCircle(30, 35, 15, 0xFFE0);
+    addText(8, 14, "panel 1", 0xFFFF);
+
+    addRect(30, 30, 90, 80, 0x0410);
+    addCircle(60, 55, 18, 0xF800);
+    addText(34, 34, "panel 2", 0xFFFF);
+
+    addRect(10, 50, 70, 90, 0x8010);
+    addText(14, 54, "panel 3", 0xFFFF);
+    addCircle(40, 75, 9, 0x07E0);
+
+    addRect(0, 0, 95, 8, 0x0000);
+    addText(2, 0, "12:34", 0xFFFF);
+
+    stats = redrawBoth(NULL);
+    printf("layered panels: %u shapes and %lu pixels skipped, %lu bytes sent instead of %lu\n",
+        stats.shapesSkipped, (unsigned long)stats.pixelsSkipped, (unsigned long)culledBytes, (unsigned long)plainBytes);
+    CHECK(stats.shapesSkipped > 0);
+    CHECK(culledBytes < plainBytes);
+}
+
+int main(void)
+{
+    testHidden();
+    testEdgeTrim();
+    testNoTrim();
+    testCombined();
+    testCircleOccluder();
+    testNoOccluder();
+    testLayeredPanels();
+    CHECK_EQ(sim_strayBytes, 0);
+    return CHECK_DONE();
+}
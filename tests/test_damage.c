@@ -0,0 +1,169 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Damage list decisions: which rects merge under the window cost, how a
+ * full list folds new damage into the rect that grows the least, and the
+ * areas of rects that span the whole 8-bit coordinate range. */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "../oledDriver/oledC_damage.h"
+#include "sim/check.h"
+
+int check_failures;
+
+static oledC_damageList_t list;
+
+static bool hasRect(uint8_t xs, uint8_t ys, uint8_t xe, uint8_t ye)
+{
+    uint8_t i;
+    for(i = 0; i < list.count; i++)
+    {
+        const oledC_rect_t *r = &list.rects[i];
+        if(r->xs == xs && r->ys == ys && r->xe == xe && r->ye == ye)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void testMergeDecisions(void)
+{
+    memset(&list, 0, sizeof(list));
+    /* overlapping and touching rects merge */
+    oledC_damageListAdd(&list, 10, 10, 19, 19);
+    oledC_damageListAdd(&list, 15, 10, 24, 19);
+    CHECK_EQ(list.count, 1);
+    CHECK(hasRect(10, 10, 24, 19));
+    oledC_damageListAdd(&list, 25, 10, 30, 19);
+    CHECK_EQ(list.count, 1);
+    CHECK(hasRect(10, 10, 30, 19));
+
+    /* overlapping squares offset diagonally leave two corners uncovered,
+     * more than one window costs */
+    oledC_damageListAdd(&list, 40, 40, 49, 49);
+    oledC_damageListAdd(&list, 45, 45, 54, 54);
+    CHECK_EQ(list.count, 3);
+
+    /* a gap the window cost pays for merges, a wider one does not */
+    memset(&list, 0, sizeof(list));
+    oledC_damageListAdd(&list, 0, 0, 3, 3);
+    oledC_damageListAdd(&list, 0, 5, 3, 8);
+    CHECK_EQ(list.count, 1);
+    oledC_damageListAdd(&list, 0, 30, 3, 33);
+    CHECK_EQ(list.count, 2);
+    CHECK(hasRect(0, 0, 3, 8));
+    CHECK(hasRect(0, 30, 3, 33));
+
+    /* diagonal corners would cost the whole square */
+    memset(&list, 0, sizeof(list));
+    oledC_damageListAdd(&list, 0, 0, 4, 4);
+    oledC_damageListAdd(&list, 90, 90, 95, 95);
+    CHECK_EQ(list.count, 2);
+
+    /* a rect bridging two entries absorbs both */
+    oledC_damageListAdd(&list, 0, 0, 95, 95);
+    CHECK_EQ(list.count, 1);
+    CHECK(hasRect(0, 0, 95, 95));
+
+    /* empty rects are ignored */
+    memset(&list, 0, sizeof(list));
+    oledC_damageListAdd(&list, 5, 5, 4, 5);
+    oledC_damageListAdd(&list, 5, 5, 5, 4);
+    CHECK_EQ(list.count, 0);
+}
+
+static void testOverflow(void)
+{
+    uint8_t i;
+    memset(&list, 0, sizeof(list));
+    /* single pixels far enough apart never merge */
+    for(i = 0; i < OLEDC_DAMAGE_MAX_RECTS; i++)
+    {
+        oledC_damageListAdd(&list, (i % 4) * 30, (i / 4) * 60, (i % 4) * 30, (i / 4) * 60);
+    }
+    CHECK_EQ(list.count, OLEDC_DAMAGE_MAX_RECTS);
+
+    /* the next one folds into the nearest entry, leaving the rest alone */
+    oledC_damageListAdd(&list, 62, 64, 62, 64);
+    CHECK_EQ(list.count, OLEDC_DAMAGE_MAX_RECTS);
+    CHECK(hasRect(60, 60, 62, 64));
+    CHECK(hasRect(0, 0, 0, 0));
+    CHECK(hasRect(90, 60, 90, 60));
+
+    /* damage inside an entry adds no growth and changes nothing */
+    oledC_damageListAdd(&list, 61, 62, 61, 62);
+    CHECK_EQ(list.count, OLEDC_DAMAGE_MAX_RECTS);
+    CHECK(hasRect(60, 60, 62, 64));
+}
+
+static void testFullRange(void)
+{
+    /* the union spans 256x256 pixels, which does not fit in 16 bits */
+    memset(&list, 0, sizeof(list));
+    oledC_damageListAdd(&list, 0, 0, 0, 0);
+    oledC_damageListAdd(&list, 255, 255, 255, 255);
+    CHECK_EQ(list.count, 2);
+
+    /* two halves of the full range are worth one window */
+    memset(&list, 0, sizeof(list));
+    oledC_damageListAdd(&list, 0, 0, 127, 255);
+    oledC_damageListAdd(&list, 128, 0, 255, 255);
+    CHECK_EQ(list.count, 1);
+    CHECK(hasRect(0, 0, 255, 255));
+
+    /* a full list folds into the entry that grows the least, even when the
+     * other choice would wrap a 16-bit area */
+    memset(&list, 0, sizeof(list));
+    oledC_damageListAdd(&list, 0, 0, 0, 0);
+    for(list.count = 1; list.count < OLEDC_DAMAGE_MAX_RECTS; list.count++)
+    {
+        list.rects[list.count] = list.rects[0];
+    }
+    list.rects[1].xs = list.rects[1].xe = 200;
+    list.rects[1].ys = list.rects[1].ye = 255;
+    oledC_damageListAdd(&list, 255, 255, 255, 255);
+    CHECK(hasRect(200, 255, 255, 255));
+    CHECK(!hasRect(0, 0, 255, 255));
+}
+
+static void testDefaultList(void)
+{
+    oledC_damageClear();
+    oledC_damageAdd(1, 2, 3, 4);
+    CHECK_EQ(oledC_damageCount(), 1);
+    CHECK_EQ(oledC_damageGet(0)->xe, 3);
+    CHECK(oledC_damageGet(1) == NULL);
+    oledC_damageClear();
+    CHECK_EQ(oledC_damageCount(), 0);
+}
+
+int main(void)
+{
+    testMergeDecisions();
+    testOverflow();
+    testFullRange();
+    testDefaultList();
+    return CHECK_DONE();
+}
@@ -0,0 +1,167 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Framebuffer golden images: fbFillRect, the palette lookup and fbFlush must
+ * leave the panel exactly as drawing straight to it does, and the watch face
+ * must match golden/watchface.ppm (make update-golden after a deliberate
+ * change of the face) */
+
+#define main watchMain
+#include "../main.c"
+#undef main
+
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+int check_failures;
+
+static uint16_t direct[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE];
+static uint16_t buffered[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE];
+
+void SYSTEM_Initialize(void)
+{
+}
+
+typedef struct
+{
+    uint8_t xs, ys, xe, ye;
+    uint16_t color;
+} rect_t;
+
+static uint32_t seed = 1;
+
+static uint8_t random8(uint8_t limit)
+{
+    seed = seed * 1103515245UL + 12345UL;
+    return (seed >> 16) % limit;
+}
+
+static uint8_t makeRects(rect_t *rects, uint8_t count, uint8_t colors)
+{
+    uint8_t i;
+    for(i = 0; i < count; i++)
+    {
+        rects[i].xs = random8(96);
+        rects[i].ys = random8(96);
+        rects[i].xe = rects[i].xs + random8(40);
+        rects[i].ye = rects[i].ys + random8(40);
+        /* spread over the whole RGB565 range, ends past the edge included */
+        rects[i].color = (uint16_t)(random8(colors) * 0x9E37U + 0x0841U);
+    }
+    return count;
+}
+
+/* Same rectangles through the framebuffer and straight onto the panel; with
+ * more colours than palette entries, straight draws use the substitute the
+ * framebuffer stored when the rectangle was filled */
+static void compareRects(uint8_t count, uint8_t colors, bool exact, const char *ppm)
+{
+    rect_t rects[60];
+    uint16_t stored[60];
+    uint8_t i;
+
+    makeRects(rects, count, colors);
+    sim_panelStart(0);
+    oledC_fbClear(0);
+    oledC_fbFlush();
+    for(i = 0; i < count; i++)
+    {
+        oledC_fbFillRect(rects[i].xs, rects[i].ys, rects[i].xe, rects[i].ye, rects[i].color);
+        stored[i] = oledC_fbGetPixel(rects[i].xs, rects[i].ys);
+    }
+    oledC_fbFlush();
+    CHECK(!oledC_fbIsDirty());
+    sim_panelSnapshot(buffered);
+    sim_writePpm(ppm, buffered);
+
+    sim_panelStart(0);
+    oledC_setDrawTarget(OLEDC_TARGET_PANEL);
+    for(i = 0; i < count; i++)
+    {
+        CHECK(!exact || stored[i] == rects[i].color);
+        oledC_DrawRectangle(rects[i].xs, rects[i].ys, rects[i].xe, rects[i].ye, stored[i]);
+    }
+    sim_panelSnapshot(direct);
+    CHECK_EQ(sim_countDiff(buffered, direct), 0);
+    CHECK_EQ(sim_strayBytes, 0);
+}
+
+static void testRectangles(void)
+{
+    /* ten colours plus the face's three still fit the palette */
+    compareRects(60, 10, true, "build/fb_rects.ppm");
+}
+
+static void testPaletteOverflow(void)
+{
+    compareRects(60, 40, false, "build/fb_palette.ppm");
+}
+
+/* The watch face rendered by its widgets into the framebuffer, against the
+ * same scene redrawn directly onto the panel */
+static void renderDirect(void)
+{
+    sim_panelStart(OLEDC_COLOR_BLACK);
+    oledC_setDrawTarget(OLEDC_TARGET_PANEL);
+    oledC_redrawAll();
+    oledC_setDrawTarget(OLEDC_TARGET_FRAMEBUFFER);
+    sim_panelSnapshot(direct);
+}
+
+static void testWatchFace(void)
+{
+    uint8_t i;
+
+    sim_panelStart(OLEDC_COLOR_BLACK);
+    oledC_fbClear(OLEDC_COLOR_BLACK);
+    oledC_fbFlush();
+    SetupWatchFace();
+    currentTime.hour = 13;
+    currentTime.minute = 59;
+    currentTime.second = 57;
+    currentTime.day = 17;
+    currentTime.month = 10;
+    DrawTimeDate();
+    sim_panelSnapshot(buffered);
+    sim_writePpm("build/watchface.ppm", buffered);
+    CHECK(sim_ppmMatches("golden/watchface.ppm", buffered));
+
+    /* ticks only push damage, the result must still be the full scene */
+    for(i = 0; i < 4; i++)
+    {
+        _T1Interrupt();
+    }
+    use12HourFormat = true;
+    DrawTimeDate();
+    sim_panelSnapshot(buffered);
+    renderDirect();
+    CHECK_EQ(sim_countDiff(buffered, direct), 0);
+}
+
+int main(void)
+{
+    /* the palette is never emptied, so the face gets it first */
+    testWatchFace();
+    testRectangles();
+    testPaletteOverflow();
+    return CHECK_DONE();
+}
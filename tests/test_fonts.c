@@ -0,0 +1,183 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Every glyph of the generated fonts against the bitmaps tools/fontc.py
+ * builds them from (build/font_glyphs.txt, written by font_glyphs.py).
+ * Each glyph is drawn as an opaque cell on the panel, once streamed in a
+ * window and once clipped at the right edge, and through the framebuffer;
+ * the cell must match the bitmap, the spacing columns must be background
+ * and nothing outside the cell may change. */
+
+#include <stdio.h>
+#include <string.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "../oledDriver/oledC_font.h"
+#include "../oledDriver/oledC_fontData.h"
+#include "../oledDriver/oledC_framebuffer.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define PAPER 0x1234
+#define FG 0xFFE0
+#define BG 0x0010
+#define CELL_X 3
+#define CELL_Y 5
+
+int check_failures;
+
+static const struct
+{
+    const char *name;
+    const oledC_font_t *font;
+} fonts[] = {
+    {"small", &oledC_font_small},
+    {"digits2x", &oledC_font_digits2x},
+    {"digits3x", &oledC_font_digits3x},
+};
+
+static const oledC_font_t *font;
+static char rows[SIZE][SIZE + 2];
+static uint8_t height, spacing;
+
+static const oledC_font_t *findFont(const char *name)
+{
+    uint8_t i;
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++)
+    {
+        if(!strcmp(fonts[i].name, name))
+        {
+            return fonts[i].font;
+        }
+    }
+    return NULL;
+}
+
+/* expected colour at screen (x, y) for a cell at (cellX, cellY) */
+static uint16_t expected(uint8_t x, uint8_t y, uint8_t cellX, uint8_t cellY, uint8_t width)
+{
+    int16_t cx = x - cellX, cy = y - cellY;
+    if(cx < 0 || cy < 0 || cx >= width + spacing || cy >= height)
+    {
+        return PAPER;
+    }
+    return cx < width && rows[cy][cx] == '#' ? FG : BG;
+}
+
+static uint16_t countWrong(const uint16_t *pixels, uint8_t cellX, uint8_t cellY, uint8_t width)
+{
+    uint8_t x, y;
+    uint16_t wrong = 0;
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            wrong += pixels[y * SIZE + x] != expected(x, y, cellX, cellY, width);
+        }
+    }
+    return wrong;
+}
+
+static uint16_t drawOnPanel(uint8_t ch, uint8_t cellX, uint8_t width)
+{
+    static uint16_t pixels[SIZE * SIZE];
+    sim_panelStart(PAPER);
+    CHECK_EQ(oledC_DrawGlyph(cellX, CELL_Y, font, ch, FG, BG), width + spacing);
+    sim_panelSnapshot(pixels);
+    return countWrong(pixels, cellX, CELL_Y, width);
+}
+
+static uint16_t drawInFramebuffer(uint8_t ch, uint8_t width)
+{
+    static uint16_t pixels[SIZE * SIZE];
+    uint8_t x, y;
+    oledC_setDrawTarget(OLEDC_TARGET_FRAMEBUFFER);
+    oledC_fbClear(PAPER);
+    oledC_DrawGlyph(CELL_X, CELL_Y, font, ch, FG, BG);
+    oledC_setDrawTarget(OLEDC_TARGET_PANEL);
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            pixels[y * SIZE + x] = oledC_fbGetPixel(x, y);
+        }
+    }
+    return countWrong(pixels, CELL_X, CELL_Y, width);
+}
+
+static void checkGlyph(const char *name, uint8_t ch, uint8_t width)
+{
+    /* the last column of the cell lands past the right edge */
+    uint8_t edgeX = SIZE + 1 - width - spacing;
+    uint16_t wrong;
+
+    CHECK_EQ(oledC_fontGlyphWidth(font, ch), width);
+    wrong = drawOnPanel(ch, CELL_X, width) + drawOnPanel(ch, edgeX, width) + drawInFramebuffer(ch, width);
+    if(wrong)
+    {
+        printf("%s glyph 0x%02X: %u pixels differ\n", name, ch, wrong);
+        check_failures++;
+    }
+}
+
+int main(void)
+{
+    char line[128], name[32];
+    unsigned value, width, glyphs = 0, fontCount = 0;
+    uint8_t row;
+    FILE *f = fopen("build/font_glyphs.txt", "r");
+
+    if(!f)
+    {
+        printf("build/font_glyphs.txt: missing, run make\n");
+        return 1;
+    }
+    while(fgets(line, sizeof(line), f))
+    {
+        if(sscanf(line, "font %31s %u %u", name, &value, &width) == 3)
+        {
+            font = findFont(name);
+            CHECK(font != NULL);
+            if(!font)
+            {
+                break;
+            }
+            height = value;
+            spacing = width;
+            CHECK_EQ(font->height, height);
+            CHECK_EQ(font->spacing, spacing);
+            fontCount++;
+        }
+        else if(sscanf(line, "glyph %u %u", &value, &width) == 2)
+        {
+            for(row = 0; row < height && fgets(rows[row], sizeof(rows[row]), f); row++);
+            CHECK_EQ(row, height);
+            checkGlyph(name, value, width);
+            glyphs++;
+        }
+    }
+    fclose(f);
+    CHECK_EQ(fontCount, sizeof(fonts) / sizeof(fonts[0]));
+    printf("%u glyphs in %u fonts checked\n", glyphs, fontCount);
+    return CHECK_DONE();
+}
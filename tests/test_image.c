@@ -0,0 +1,146 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* oledC_DrawImage against tools/imgc.py: fixtures/image.ppm is encoded by
+ * the tool (build/img_fixture.c) and drawn streamed, clipped at every panel
+ * edge, through a viewport and into the framebuffer; every pixel must match
+ * the PPM reduced to RGB565 and nothing around the image may change. The
+ * fixture has a run longer than the long-run limit, runs wrapping across
+ * rows and single-pixel runs. */
+
+#include <stdio.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "../oledDriver/oledC_framebuffer.h"
+#include "build/img_fixture.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define PAPER 0x1234
+#define MAX_PIXELS (SIZE * SIZE)
+
+int check_failures;
+
+static uint16_t source[MAX_PIXELS];
+static uint8_t sourceWidth, sourceHeight;
+static uint16_t pixels[SIZE * SIZE];
+
+/* the image placed at screen (x, y), cut to the clip rectangle */
+static uint16_t countWrong(int16_t x, int16_t y, int16_t clipXs, int16_t clipYs, int16_t clipXe, int16_t clipYe)
+{
+    int16_t px, py, ix, iy;
+    uint16_t wrong = 0, want;
+    for(py = 0; py < SIZE; py++)
+    {
+        for(px = 0; px < SIZE; px++)
+        {
+            ix = px - x;
+            iy = py - y;
+            want = PAPER;
+            if(ix >= 0 && iy >= 0 && ix < sourceWidth && iy < sourceHeight &&
+                px >= clipXs && px <= clipXe && py >= clipYs && py <= clipYe)
+            {
+                want = source[iy * sourceWidth + ix];
+            }
+            if(pixels[py * SIZE + px] != want && wrong++ == 0)
+            {
+                printf("first mismatch at (%d, %d): 0x%04X, expected 0x%04X\n", px, py, pixels[py * SIZE + px], want);
+            }
+        }
+    }
+    return wrong;
+}
+
+static uint16_t drawOnPanel(uint8_t x, uint8_t y)
+{
+    sim_panelStart(PAPER);
+    oledC_DrawImage(x, y, &oledC_image_fixture);
+    sim_panelSnapshot(pixels);
+    CHECK_EQ(sim_strayBytes, 0);
+    return countWrong(x, y, 0, 0, SIZE - 1, SIZE - 1);
+}
+
+static void testPlacement(void)
+{
+    CHECK_EQ(oledC_image_fixture.width, sourceWidth);
+    CHECK_EQ(oledC_image_fixture.height, sourceHeight);
+    CHECK_EQ(drawOnPanel(10, 20), 0);
+    CHECK_EQ(drawOnPanel(0, 0), 0);
+    CHECK_EQ(drawOnPanel(SIZE - sourceWidth, SIZE - sourceHeight), 0);
+
+    /* over the right and bottom edges, and past the 8-bit wrap */
+    CHECK_EQ(drawOnPanel(70, 30), 0);
+    CHECK_EQ(drawOnPanel(20, 80), 0);
+    CHECK_EQ(drawOnPanel(90, 90), 0);
+    CHECK_EQ(drawOnPanel(230, 10), 0);
+    CHECK_EQ(drawOnPanel(SIZE, 0), 0);
+}
+
+static void testViewport(void)
+{
+    /* origin left of and above the panel: the left and top edges clip */
+    sim_panelStart(PAPER);
+    CHECK(oledC_pushViewport(-20, -15, 120, 120));
+    oledC_DrawImage(0, 0, &oledC_image_fixture);
+    oledC_popViewport();
+    sim_panelSnapshot(pixels);
+    CHECK_EQ(countWrong(-20, -15, 0, 0, SIZE - 1, SIZE - 1), 0);
+
+    /* a clip through the middle of the image */
+    sim_panelStart(PAPER);
+    CHECK(oledC_pushClip(25, 30, 17, 13));
+    oledC_DrawImage(10, 20, &oledC_image_fixture);
+    oledC_popViewport();
+    sim_panelSnapshot(pixels);
+    CHECK_EQ(countWrong(10, 20, 25, 30, 41, 42), 0);
+}
+
+static void testFramebuffer(void)
+{
+    uint8_t x, y;
+    oledC_setDrawTarget(OLEDC_TARGET_FRAMEBUFFER);
+    oledC_fbClear(PAPER);
+    oledC_DrawImage(60, 70, &oledC_image_fixture);
+    oledC_setDrawTarget(OLEDC_TARGET_PANEL);
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            pixels[y * SIZE + x] = oledC_fbGetPixel(x, y);
+        }
+    }
+    CHECK_EQ(countWrong(60, 70, 0, 0, SIZE - 1, SIZE - 1), 0);
+}
+
+int main(void)
+{
+    if(!sim_readPpm("fixtures/image.ppm", source, MAX_PIXELS, &sourceWidth, &sourceHeight))
+    {
+        printf("fixtures/image.ppm: cannot read\n");
+        return 1;
+    }
+    testPlacement();
+    testViewport();
+    testFramebuffer();
+    return CHECK_DONE();
+}
@@ -0,0 +1,292 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* oledC_DrawLine against two references on the panel model:
+ *  - refLine, a textbook Bresenham walk plotted point by point, in all
+ *    eight octants with end points on the screen edges; thick lines are
+ *    compared with the ideal capsule of half width width / 2 + 0.5
+ *  - oldLine, the rasterizer the driver shipped with. It only walks
+ *    x0 < x1 with 0 <= slope <= 1, leaves out the end point and biases its
+ *    error term, so it is compared within one pixel of the new stroke. */
+
+#include <math.h>
+#include <stdlib.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+
+int check_failures;
+
+static uint16_t actual[SIZE * SIZE];
+static uint16_t expected[SIZE * SIZE];
+static uint16_t mismatches;
+
+/* the original oledC_DrawLine, kept as it was */
+static void oldLine(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t width, uint16_t color)
+{
+    int8_t x, y;
+    int8_t dx, dy, D;
+    width = width <= 1 ? 1 : width;
+
+    dx = x1 - x0;
+    dy = y1 - y0;
+    D = dy - dx;
+    y = y0;
+
+    for(x = x0; x < x1; x++)
+    {
+        if(x <= 0x5F && y <= 0x5F)
+        {
+            if(width <= 1)
+            {
+                oledC_DrawPoint(x,y, color);
+            }
+            else
+            {
+                oledC_DrawCircle(x, y, width/2, color);
+            }
+        }
+        if(D >= 0)
+        {
+            y = y+1;
+            D = D - dx;
+        }
+        D = D + dy;
+    }
+}
+
+static void refLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    int16_t dx = abs(x1 - x0), dy = abs(y1 - y0);
+    int16_t sx = x1 > x0 ? 1 : -1, sy = y1 > y0 ? 1 : -1;
+    int16_t err = dx - dy, e2;
+    for(;;)
+    {
+        oledC_DrawPoint(x0, y0, 0xFFFF);
+        if(x0 == x1 && y0 == y1)
+        {
+            break;
+        }
+        e2 = 2 * err;
+        if(e2 > -dy)
+        {
+            err -= dy;
+            x0 += sx;
+        }
+        if(e2 < dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static void reportLine(const char *what, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width)
+{
+    if(++mismatches <= 5)
+    {
+        printf("%s mismatch: (%d, %d) - (%d, %d) width %u\n", what, x0, y0, x1, y1, width);
+    }
+    check_failures++;
+}
+
+static void checkThin(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    sim_panelStart(0);
+    oledC_DrawLine(x0, y0, x1, y1, 1, 0xFFFF);
+    sim_panelSnapshot(actual);
+    sim_panelStart(0);
+    refLine(x0, y0, x1, y1);
+    sim_panelSnapshot(expected);
+    if(sim_countDiff(actual, expected) != 0)
+    {
+        reportLine("thin", x0, y0, x1, y1, 1);
+    }
+}
+
+/* 1: inside the capsule, 0: outside, -1: pixel centre within 1/8 pixel of
+ * the border, where the 1/16 pixel fixed point of the driver may go either
+ * way. The caps follow the circle rule x^2 + y^2 <= r^2 + r. */
+static int8_t inCapsule(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t radius, int16_t x, int16_t y)
+{
+    double dx = x1 - x0, dy = y1 - y0, length = sqrt(dx * dx + dy * dy);
+    double t, side, half = radius + 0.5;
+    int32_t c0 = (int32_t)(x - x0) * (x - x0) + (int32_t)(y - y0) * (y - y0);
+    int32_t c1 = (int32_t)(x - x1) * (x - x1) + (int32_t)(y - y1) * (y - y1);
+    int32_t capLimit = (int32_t)radius * radius + radius;
+    if(c0 <= capLimit || c1 <= capLimit)
+    {
+        return 1;
+    }
+    if(length == 0)
+    {
+        return 0;
+    }
+    t = ((x - x0) * dx + (y - y0) * dy) / length;
+    side = fabs((x - x0) * dy - (y - y0) * dx) / length;
+    if(fabs(side - half) < 0.125 || fabs(t) < 0.125 || fabs(t - length) < 0.125)
+    {
+        return -1;
+    }
+    return t > 0 && t < length && side < half;
+}
+
+static void checkThick(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width)
+{
+    int16_t x, y;
+    int8_t inside;
+    sim_panelStart(0);
+    oledC_DrawLine(x0, y0, x1, y1, width, 0xFFFF);
+    sim_panelSnapshot(actual);
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            inside = inCapsule(x0, y0, x1, y1, width >> 1, x, y);
+            if(inside >= 0 && inside != (actual[y * SIZE + x] != 0))
+            {
+                reportLine("thick", x0, y0, x1, y1, width);
+                return;
+            }
+        }
+    }
+}
+
+/* every lit pixel of one snapshot has a lit pixel of the other at most one
+ * pixel away (8-neighbourhood) */
+static bool within1(const uint16_t *a, const uint16_t *b)
+{
+    int16_t x, y, nx, ny;
+    bool near;
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            if(!a[y * SIZE + x])
+            {
+                continue;
+            }
+            near = false;
+            for(ny = y - 1; ny <= y + 1 && !near; ny++)
+            {
+                for(nx = x - 1; nx <= x + 1 && !near; nx++)
+                {
+                    near = nx >= 0 && ny >= 0 && nx < SIZE && ny < SIZE && b[ny * SIZE + nx];
+                }
+            }
+            if(!near)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void checkOld(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t width)
+{
+    sim_panelStart(0);
+    oledC_DrawLine(x0, y0, x1, y1, width, 0xFFFF);
+    sim_panelSnapshot(actual);
+    sim_panelStart(0);
+    oldLine(x0, y0, x1, y1, width, 0xFFFF);
+    sim_panelSnapshot(expected);
+    if(!within1(actual, expected) || !within1(expected, actual))
+    {
+        reportLine("old", x0, y0, x1, y1, width);
+    }
+}
+
+/* end points: the centre, the corners and every fifth pixel of each edge,
+ * which puts lines from the centre in all eight octants */
+static uint8_t edgePoints(int16_t *px, int16_t *py)
+{
+    uint8_t count = 0;
+    int16_t i;
+    px[count] = 48;
+    py[count++] = 48;
+    for(i = 0; i < SIZE; i += 5)
+    {
+        px[count] = i;
+        py[count++] = 0;
+        px[count] = i;
+        py[count++] = SIZE - 1;
+        px[count] = 0;
+        py[count++] = i;
+        px[count] = SIZE - 1;
+        py[count++] = i;
+    }
+    px[count] = SIZE - 1;
+    py[count++] = SIZE - 1;
+    return count;
+}
+
+static void testAgainstReference(void)
+{
+    int16_t px[100], py[100];
+    uint8_t count = edgePoints(px, py), i, j, width;
+    for(i = 0; i < count; i++)
+    {
+        for(j = 0; j < count; j++)
+        {
+            checkThin(px[i], py[i], px[j], py[j]);
+            for(width = 2; width <= 4; width++)
+            {
+                checkThick(px[i], py[i], px[j], py[j], width);
+            }
+        }
+    }
+}
+
+/* the old rasterizer's own domain; dx stays below 64 so its int8_t error
+ * term does not overflow */
+static void testAgainstOld(void)
+{
+    uint8_t x0, y0, dx, dy, width;
+    for(x0 = 0; x0 < SIZE; x0 += 19)
+    {
+        for(y0 = 0; y0 < SIZE; y0 += 19)
+        {
+            for(dx = 1; dx < 64 && x0 + dx < SIZE; dx += 3)
+            {
+                for(dy = 0; dy <= dx && y0 + dy < SIZE; dy += 2)
+                {
+                    for(width = 1; width <= 4; width++)
+                    {
+                        checkOld(x0, y0, x0 + dx, y0 + dy, width);
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    testAgainstReference();
+    testAgainstOld();
+    CHECK_EQ(sim_strayBytes, 0);
+    return CHECK_DONE();
+}
@@ -0,0 +1,138 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* oledC DMA sends: data RAM goes out by DMA, other sources fall back to the
+ * CPU, and the SPI1 handler in place before a transfer is restored after it */
+
+#include <xc.h>
+#include "../oledDriver/oledC.h"
+#include "../spiDriver/spi1_driver.h"
+#include "sim/sim_panel.h"
+#include "sim/sim_spi1.h"
+#include "sim/check.h"
+
+int check_failures;
+static int doneCalls;
+static int otherCalls;
+
+static const uint16_t flashPixels[] = {0x1111, 0x2222, 0x3333, 0x4444};
+
+static void onDone(void)
+{
+    doneCalls++;
+}
+
+static void otherHandler(void)
+{
+    otherCalls++;
+}
+
+static void start(void)
+{
+    sim_panelStart(0);
+    doneCalls = otherCalls = 0;
+    spi1_setSpiISR(otherHandler);
+    oledC_setTransferDoneCallback(onDone);
+    oledC_setColumnAddressBounds(10, 13);
+    oledC_setRowAddressBounds(5, 5);
+}
+
+static void testRamPixels(void)
+{
+    uint16_t pixels[] = {0xF800, 0x07E0, 0x001F, 0xFFFF};
+    uint32_t transfers;
+
+    start();
+    transfers = sim_spiDmaTransfers;
+    CHECK(oledC_sendPixelsAsync(pixels, 4));
+    CHECK_EQ(sim_spiDmaTransfers, transfers + 1);
+    CHECK(oledC_isTransferBusy());
+    CHECK(spi1_getSpiISR() != otherHandler);
+    CHECK(!oledC_sendPixelsAsync(pixels, 4));
+    CHECK_EQ(doneCalls, 0);
+
+    sim_spiDmaFinish();
+    CHECK_EQ(doneCalls, 1);
+    CHECK_EQ(otherCalls, 0);
+    CHECK(spi1_getSpiISR() == otherHandler);
+    CHECK(!oledC_isTransferBusy());
+    CHECK_EQ(sim_panelPixel(10, 5), 0xF800);
+    CHECK_EQ(sim_panelPixel(13, 5), 0xFFFF);
+    CHECK_EQ(sim_strayBytes, 0);
+}
+
+static void testFlashPixels(void)
+{
+    uint32_t transfers;
+
+    start();
+    sim_spiMapFlash(flashPixels, sizeof(flashPixels));
+    transfers = sim_spiDmaTransfers;
+    CHECK(oledC_sendPixelsAsync(flashPixels, 4));
+    CHECK_EQ(sim_spiDmaTransfers, transfers);
+    CHECK(!oledC_isTransferBusy());
+    CHECK_EQ(doneCalls, 1);
+    CHECK(spi1_getSpiISR() == otherHandler);
+    CHECK_EQ(sim_panelPixel(10, 5), 0x1111);
+    CHECK_EQ(sim_panelPixel(13, 5), 0x4444);
+    sim_spiMapFlash(NULL, 0);
+}
+
+static void testColorRun(void)
+{
+    start();
+    CHECK(oledC_sendColorRunAsync(0x07E0, 4));
+    CHECK(spi1_getSpiISR() != otherHandler);
+    /* any other panel access waits for the transfer */
+    oledC_setColumnAddressBounds(0, 0);
+    CHECK_EQ(doneCalls, 1);
+    CHECK(spi1_getSpiISR() == otherHandler);
+    CHECK_EQ(sim_panelPixel(11, 5), 0x07E0);
+    CHECK(!oledC_sendColorRunAsync(0x07E0, 0));
+    CHECK(spi1_getSpiISR() == otherHandler);
+}
+
+/* a CPU write right after a DMA send, into the same (cached) window, must
+ * start a new RAM write instead of joining the finished one */
+static void testSyncAfterAsync(void)
+{
+    uint16_t pixels[] = {0x1234, 0x1234, 0x1234, 0x1234};
+
+    start();
+    CHECK(oledC_sendPixelsAsync(pixels, 4));
+    oledC_setColumnAddressBounds(10, 13);
+    oledC_setRowAddressBounds(5, 5);
+    oledC_sendColorRun(0xF800, 4);
+    CHECK_EQ(doneCalls, 1);
+    CHECK_EQ(sim_panelPixel(10, 5), 0xF800);
+    CHECK_EQ(sim_panelPixel(13, 5), 0xF800);
+    CHECK_EQ(sim_strayBytes, 0);
+}
+
+int main(void)
+{
+    testRamPixels();
+    testFlashPixels();
+    testColorRun();
+    testSyncAfterAsync();
+    return CHECK_DONE();
+}
@@ -0,0 +1,159 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Shape and framebuffer palettes: entries are released with the last shape
+ * or pixel using them, so a new colour is stored exactly once an entry is
+ * free again; the closest colour fallback weights the 5/6/5 fields. */
+
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapeHandler.h"
+#include "../oledDriver/oledC_framebuffer.h"
+#include "sim/check.h"
+
+int check_failures;
+
+static oledC_shapeHandle_t addPoint(uint8_t x, uint16_t color)
+{
+    shape_params_t p;
+    p.point.color = color;
+    p.point.x = x;
+    p.point.y = 0;
+    return oledC_insertShape(OLED_SHAPE_POINT, &p, OLEDC_SHAPE_NONE);
+}
+
+static uint16_t storedColor(oledC_shapeHandle_t handle)
+{
+    shape_params_t p;
+    enum OLEDC_SHAPE type;
+    oledC_getShapeParams(handle, &type, &p);
+    return p.point.color;
+}
+
+static uint8_t colorsInUse(void)
+{
+    oledC_shapeStoreStats_t stats;
+    oledC_shapeStoreStats(&stats);
+    return stats.colors;
+}
+
+static void testRelease(void)
+{
+    oledC_shapeHandle_t handles[16], extra;
+    shape_params_t p;
+    uint8_t i;
+
+    initShapesMem();
+    for(i = 0; i < 16; i++)
+    {
+        handles[i] = addPoint(i, 0x1000 + i);
+    }
+    CHECK_EQ(colorsInUse(), 16);
+    /* full: a 17th colour is substituted */
+    extra = addPoint(20, 0xF81F);
+    CHECK(storedColor(extra) != 0xF81F);
+    oledC_deleteShape(extra);
+
+    /* deleting the last user of an entry frees it */
+    oledC_deleteShape(handles[3]);
+    CHECK_EQ(colorsInUse(), 15);
+    extra = addPoint(20, 0xF81F);
+    CHECK_EQ(storedColor(extra), 0xF81F);
+    CHECK_EQ(colorsInUse(), 16);
+
+    /* so does giving it another colour */
+    p.point.color = 0x1005;
+    p.point.x = 5;
+    p.point.y = 0;
+    oledC_updateShape(handles[4], &p);
+    CHECK_EQ(colorsInUse(), 15);
+    CHECK_EQ(storedColor(handles[4]), 0x1005);
+    oledC_updateShape(handles[6], &p);
+    p.point.color = 0x07E0;
+    oledC_updateShape(handles[7], &p);
+    CHECK_EQ(storedColor(handles[7]), 0x07E0);
+    CHECK_EQ(storedColor(handles[5]), 0x1005);
+    CHECK_EQ(storedColor(handles[8]), 0x1008);
+}
+
+/* one red step against one green step: the red field is half as fine */
+static void testWeightedDistance(void)
+{
+    static const uint16_t palette[2] = {0x0800, 0x0020};
+    uint8_t i;
+    CHECK_EQ(oledC_closestColor(palette, 2, 0x0000), 1);
+    CHECK_EQ(oledC_closestColor(palette, 2, 0x1000), 0);
+
+    /* entry 0 is black, then one red step and one green step away from
+     * grey, then white and near whites, each held by a pixel */
+    oledC_fbClear(0x0000);
+    oledC_fbSetPixel(1, 0, 0x8C10);
+    oledC_fbSetPixel(2, 0, 0x8430);
+    for(i = 3; i < OLEDC_FB_PALETTE_SIZE; i++)
+    {
+        oledC_fbSetPixel(i, 0, 0xFFFF - i);
+    }
+    CHECK_EQ(oledC_fbColorIndex(0x8410), 2);
+}
+
+static void testFramebufferRelease(void)
+{
+    uint8_t i;
+    oledC_fbClear(0x0000);
+    for(i = 1; i < OLEDC_FB_PALETTE_SIZE; i++)
+    {
+        oledC_fbFillRect(i, 0, i, 9, 0x1000 + i);
+    }
+    CHECK_EQ(oledC_fbColorsInUse(), OLEDC_FB_PALETTE_SIZE);
+    /* full: a new colour is substituted */
+    oledC_fbSetPixel(50, 50, 0xF81F);
+    CHECK(oledC_fbGetPixel(50, 50) != 0xF81F);
+
+    /* overwriting the last pixels of an entry frees it */
+    oledC_fbFillRect(3, 0, 3, 9, 0x0000);
+    oledC_fbSetPixel(50, 50, 0x0000);
+    CHECK_EQ(oledC_fbColorsInUse(), OLEDC_FB_PALETTE_SIZE - 1);
+    oledC_fbSetPixel(60, 60, 0xF81F);
+    CHECK_EQ(oledC_fbGetPixel(60, 60), 0xF81F);
+    CHECK_EQ(oledC_fbColorsInUse(), OLEDC_FB_PALETTE_SIZE);
+    /* the other colours kept their entries */
+    CHECK_EQ(oledC_fbGetPixel(4, 5), 0x1004);
+
+    /* a clear leaves one entry in use, and colours drawn one after the
+     * other and overwritten never fill the palette */
+    oledC_fbClear(0x0000);
+    CHECK_EQ(oledC_fbColorsInUse(), 1);
+    for(i = 0; i < 20; i++)
+    {
+        oledC_fbSetPixel(i, 20, 0x2000 + i);
+        CHECK_EQ(oledC_fbGetPixel(i, 20), 0x2000 + i);
+        oledC_fbSetPixel(i, 20, 0x0000);
+    }
+    CHECK_EQ(oledC_fbColorsInUse(), 1);
+}
+
+int main(void)
+{
+    testRelease();
+    testWeightedDistance();
+    testFramebufferRelease();
+    return CHECK_DONE();
+}
@@ -0,0 +1,223 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Readback and the OLS1 screenshot stream: a known pattern written to the
+ * panel model comes back through oledC_readRect and oledC_readPixels, the
+ * encoded stream decodes to the same pixels, and tools/oledc_screenshot.py
+ * turns it into the expected PPM. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_screenshot.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define STREAM_MAX (6 + SIZE * SIZE * 3)
+
+int check_failures;
+
+static uint8_t stream[STREAM_MAX];
+static uint16_t streamLength;
+static bool streamOverflow;
+
+/* runs of growing length per row, a solid row and single pixel changes */
+static uint16_t pattern(uint8_t x, uint8_t y)
+{
+    if(y == 7)
+    {
+        return 0x07E0;
+    }
+    if(y == 8)
+    {
+        return x * 0x0841;
+    }
+    return (uint16_t)(x / (y % 11 + 1)) * 0x1863 + y;
+}
+
+static void drawPattern(void)
+{
+    uint16_t row[SIZE];
+    uint8_t x, y;
+    oledC_setColumnAddressBounds(0, SIZE - 1);
+    oledC_setRowAddressBounds(0, SIZE - 1);
+    oledC_beginWriteSession();
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            row[x] = pattern(x, y);
+        }
+        oledC_sendPixels(row, SIZE);
+    }
+    oledC_endWriteSession();
+}
+
+static void testReadRect(void)
+{
+    static uint16_t pixels[SIZE * SIZE];
+    uint8_t x, y;
+    uint16_t bad = 0;
+
+    oledC_readRect(5, 3, 40, 20, pixels);
+    for(y = 3; y <= 20; y++)
+    {
+        for(x = 5; x <= 40; x++)
+        {
+            bad += pixels[(y - 3) * 36 + x - 5] != pattern(x, y);
+        }
+    }
+    CHECK_EQ(bad, 0);
+
+    /* the far corner clamps to the panel */
+    memset(pixels, 0, sizeof(pixels));
+    oledC_readRect(90, 93, 200, 120, pixels);
+    CHECK_EQ(pixels[0], pattern(90, 93));
+    CHECK_EQ(pixels[5], pattern(95, 93));
+    CHECK_EQ(pixels[17], pattern(95, 95));
+    CHECK_EQ(pixels[18], 0);
+
+    /* an empty rectangle reads nothing */
+    pixels[0] = 0xABCD;
+    oledC_readRect(10, 10, 9, 10, pixels);
+    CHECK_EQ(pixels[0], 0xABCD);
+
+    /* a raw read continues through the window set up before it */
+    oledC_setColumnAddressBounds(0, SIZE - 1);
+    oledC_setRowAddressBounds(8, 9);
+    oledC_readPixels(pixels, SIZE + 2);
+    CHECK_EQ(pixels[0], pattern(0, 8));
+    CHECK_EQ(pixels[SIZE - 1], pattern(SIZE - 1, 8));
+    CHECK_EQ(pixels[SIZE + 1], pattern(1, 9));
+    CHECK_EQ(sim_strayBytes, 0);
+}
+
+static void collect(const uint8_t *data, uint8_t length)
+{
+    if(streamLength + length > STREAM_MAX)
+    {
+        streamOverflow = true;
+        return;
+    }
+    memcpy(stream + streamLength, data, length);
+    streamLength += length;
+}
+
+static void testStream(void)
+{
+    uint16_t pos = 6, x = 0, y = 0, bad = 0, runs = 0;
+    uint8_t length;
+    uint16_t color;
+
+    streamLength = 0;
+    streamOverflow = false;
+    oledC_screenshot(collect);
+    CHECK(!streamOverflow);
+    CHECK(memcmp(stream, OLEDC_SCREENSHOT_MAGIC, 4) == 0);
+    CHECK_EQ(stream[4], SIZE);
+    CHECK_EQ(stream[5], SIZE);
+
+    while(pos + 3 <= streamLength && y < SIZE)
+    {
+        length = stream[pos] + 1;
+        color = (uint16_t)stream[pos + 1] << 8 | stream[pos + 2];
+        pos += 3;
+        runs++;
+        /* runs stay within a row */
+        CHECK(x + length <= SIZE);
+        while(length-- && x < SIZE)
+        {
+            bad += color != pattern(x, y);
+            x++;
+        }
+        if(x == SIZE)
+        {
+            x = 0;
+            y++;
+        }
+    }
+    CHECK_EQ(y, SIZE);
+    CHECK_EQ(pos, streamLength);
+    CHECK_EQ(bad, 0);
+    /* the solid row is one run, the ramp row one run per pixel */
+    CHECK(runs < SIZE * SIZE / 2);
+    printf("screenshot: %u bytes in %u runs\n", streamLength, runs);
+}
+
+/* the PPM the decoder writes, with its bit-replicating colour expansion */
+static bool decoderOutputMatches(const char *path)
+{
+    static uint8_t expected[32 + SIZE * SIZE * 3], actual[sizeof(expected)];
+    int header = sprintf((char *)expected, "P6\n%d %d\n255\n", SIZE, SIZE);
+    uint8_t *out = expected + header;
+    uint8_t x, y, r, g, b;
+    size_t size;
+    FILE *f;
+
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            r = pattern(x, y) >> 11;
+            g = (pattern(x, y) >> 5) & 0x3F;
+            b = pattern(x, y) & 0x1F;
+            *out++ = (r << 3) | (r >> 2);
+            *out++ = (g << 2) | (g >> 4);
+            *out++ = (b << 3) | (b >> 2);
+        }
+    }
+    f = fopen(path, "rb");
+    if(!f)
+    {
+        return false;
+    }
+    size = fread(actual, 1, sizeof(actual), f);
+    fclose(f);
+    return size == (size_t)(out - expected) && memcmp(actual, expected, size) == 0;
+}
+
+static void testHostDecoder(void)
+{
+    FILE *f = fopen("build/screenshot.bin", "wb");
+    CHECK(f != NULL);
+    if(!f)
+    {
+        return;
+    }
+    fwrite(stream, 1, streamLength, f);
+    fclose(f);
+    remove("build/screenshot.ppm");
+    CHECK_EQ(system("python3 ../tools/oledc_screenshot.py build/screenshot.bin build/screenshot.ppm"), 0);
+    CHECK(decoderOutputMatches("build/screenshot.ppm"));
+}
+
+int main(void)
+{
+    sim_panelStart(0);
+    drawPattern();
+    testReadRect();
+    testStream();
+    testHostDecoder();
+    return CHECK_DONE();
+}
@@ -0,0 +1,129 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Hardware scrolling on the panel model: the start line moves the picture,
+ * row writes land on logical rows, and oledC_scrollReset rotates GRAM back
+ * without changing what is shown */
+
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_scroll.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+int check_failures;
+
+static uint16_t before[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE];
+static uint16_t after[SIM_SCREEN_SIZE * SIM_SCREEN_SIZE];
+
+static uint16_t rowColor(uint8_t y)
+{
+    return (uint16_t)(y * 0x0421U + 0x1000U);
+}
+
+/* every row its own colour, plus a diagonal so columns are told apart too */
+static void drawPattern(void)
+{
+    uint8_t y;
+    for(y = 0; y < SIM_SCREEN_SIZE; y++)
+    {
+        oledC_DrawRectangle(0, y, SIM_SCREEN_SIZE - 1, y, rowColor(y));
+        oledC_DrawPoint(y, y, 0xFFFF);
+    }
+}
+
+static void testScrollUp(void)
+{
+    uint16_t row[SIM_SCREEN_SIZE];
+    uint8_t x, y;
+
+    sim_panelStart(0);
+    drawPattern();
+    sim_panelSnapshot(before);
+    oledC_scrollUp(10);
+    CHECK_EQ(sim_panelStartLine(), SIM_BASE_START_LINE + 10);
+    for(y = 0; y < SIM_SCREEN_SIZE - 10; y++)
+    {
+        CHECK_EQ(sim_panelPixel(0, y), before[(y + 10) * SIM_SCREEN_SIZE]);
+    }
+    /* the exposed rows are written through the scroll offset */
+    for(x = 0; x < SIM_SCREEN_SIZE; x++)
+    {
+        row[x] = x;
+    }
+    oledC_scrollWriteRow(95, row);
+    oledC_scrollFillRow(86, 0xF800);
+    CHECK_EQ(sim_panelPixel(40, 95), 40);
+    CHECK_EQ(sim_panelPixel(40, 86), 0xF800);
+    CHECK_EQ(sim_strayBytes, 0);
+}
+
+/* Reset keeps the picture and brings GRAM back to row y == screen row y */
+static void checkReset(void)
+{
+    uint8_t x, y;
+    sim_panelSnapshot(before);
+    oledC_scrollReset();
+    CHECK_EQ(oledC_scrollGetOffset(), 0);
+    CHECK_EQ(sim_panelStartLine(), SIM_BASE_START_LINE);
+    sim_panelSnapshot(after);
+    CHECK_EQ(sim_countDiff(after, before), 0);
+    for(y = 0; y < SIM_SCREEN_SIZE; y += 5)
+    {
+        for(x = 0; x < SIM_SCREEN_SIZE; x += 7)
+        {
+            CHECK_EQ(sim_gram[y][x + SIM_COLUMN_OFFSET], before[y * SIM_SCREEN_SIZE + x]);
+        }
+    }
+}
+
+static void testReset(void)
+{
+    static const uint8_t offsets[] = {10, 1, 37, 64, 96, 127};
+    uint8_t i;
+
+    for(i = 0; i < sizeof(offsets); i++)
+    {
+        sim_panelStart(0);
+        drawPattern();
+        oledC_scrollUp(offsets[i]);
+        oledC_scrollFillRow(95, 0x07E0);
+        checkReset();
+    }
+    sim_panelStart(0);
+    drawPattern();
+    oledC_scrollDown(37);
+    oledC_scrollFillRow(0, 0x001F);
+    checkReset();
+
+    /* regular drawing is right again after the reset */
+    oledC_DrawRectangle(0, 0, 3, 3, 0xFFE0);
+    CHECK_EQ(sim_panelPixel(2, 2), 0xFFE0);
+    CHECK_EQ(sim_panelPixel(2, 4), before[4 * SIM_SCREEN_SIZE + 2]);
+}
+
+int main(void)
+{
+    testScrollUp();
+    testReset();
+    return CHECK_DONE();
+}
@@ -0,0 +1,94 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Non-blocking bring-up against a Timer2 that runs from real time: the
+ * reset pulse and the power-up waits must hold whatever the phase of
+ * Timer2 is when a step starts. The first poll comes after some other
+ * initialization work, which moves the next step to any point of a tick.
+ * The panel only reports ready once a started bring-up has finished. */
+
+#include <xc.h>
+#include "../oledDriver/oledC.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+int check_failures;
+
+/* Timer2 period at FCY / 256 */
+#define TICK_US (256000000UL / FCY)
+
+static void runSetup(uint32_t busy)
+{
+    uint32_t now = 0, resetLow = 0, resetHigh = 0, ready = 0;
+    bool wasHigh;
+
+    sim_panelReset(0);
+    LATCbits.LATC9 = 1;
+    TMR2 = 0;
+    oledC_setupStart();
+    CHECK(!oledC_isReady());
+    wasHigh = LATAbits.LATA13;
+    now = busy;
+    while(!ready)
+    {
+        /* after the busy time, poll every microsecond */
+        now++;
+        TMR2 = (uint16_t)(now / TICK_US);
+        if(oledC_setupPoll())
+        {
+            ready = now;
+        }
+        CHECK_EQ(oledC_isReady(), ready != 0);
+        if(wasHigh && !LATAbits.LATA13)
+        {
+            resetLow = now;
+        }
+        if(!wasHigh && LATAbits.LATA13)
+        {
+            resetHigh = now;
+        }
+        wasHigh = LATAbits.LATA13;
+    }
+    CHECK(resetLow > 0 && resetHigh > resetLow);
+    /* SSD1351: reset low for at least 2 us */
+    CHECK(resetHigh - resetLow >= 2);
+    /* 1 ms after reset, then 200 ms after display on */
+    CHECK(ready - resetHigh >= 201000UL);
+    CHECK(oledC_isReady());
+    /* the final step set the remap and the start line */
+    CHECK_EQ(sim_panelStartLine(), SIM_BASE_START_LINE);
+    CHECK_EQ(sim_strayBytes, 0);
+}
+
+int main(void)
+{
+    uint32_t busy;
+    /* nothing started yet */
+    CHECK(!oledC_isReady());
+    CHECK(!oledC_setupPoll());
+    CHECK(!oledC_isReady());
+    for(busy = 2000; busy < 2000 + TICK_US; busy++)
+    {
+        runSetup(busy);
+    }
+    return CHECK_DONE();
+}
@@ -0,0 +1,160 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* spi1_driver DMA transmit: programmed registers, bytes on the wire and the
+ * done notification, against the DMA model in sim/sim_dma.c */
+
+#include <xc.h>
+#include "../spiDriver/spi1_driver.h"
+#include "sim/sim_dma.h"
+#include "sim/check.h"
+
+int check_failures;
+static int doneCalls;
+
+void _DMA0Interrupt(void);
+
+static void onDone(void)
+{
+    doneCalls++;
+}
+
+static void resetBus(void)
+{
+    sim_dmaReset();
+    doneCalls = 0;
+    SPI1STATLbits.SPITBE = 1;
+    SPI1STATLbits.SRMT = 1;
+    SPI1STATLbits.SPIRBE = 1;
+    spi1_setSpiISR(onDone);
+}
+
+/* what the hardware does when the channel finishes: the interrupt fires if enabled */
+static void finishTransfer(void)
+{
+    sim_dmaRun();
+    if(IEC0bits.DMA0IE)
+    {
+        _DMA0Interrupt();
+    }
+}
+
+static void testWriteWords(void)
+{
+    static const uint8_t expected[] = {0x12, 0x34, 0xAB, 0xCD, 0x00, 0xFF, 0xF8, 0x00};
+    uint16_t words[] = {0x1234, 0xABCD, 0x00FF, 0xF800};
+    uint8_t i;
+
+    resetBus();
+    CHECK(spi1_dmaWriteWords(words, 4));
+    CHECK_EQ(DMACNT0, 4);
+    CHECK_EQ(DMACH0bits.SAMODE, 1);
+    CHECK_EQ(DMACH0bits.SIZE, 0);
+    CHECK_EQ(DMAINT0bits.CHSEL, 0x0B);
+    CHECK_EQ(DMAL, 0x0800);
+    CHECK_EQ(DMAH, 0x47FF);
+    CHECK(SPI1CON1Lbits.MODE16);
+    CHECK(spi1_dmaBusy());
+    /* the channel is taken until the transfer completes */
+    CHECK(!spi1_dmaWriteWords(words, 1));
+    CHECK(!spi1_dmaFillWords(0, 1));
+    CHECK_EQ(doneCalls, 0);
+
+    finishTransfer();
+    CHECK_EQ(sim_spiByteCount, sizeof(expected));
+    for(i = 0; i < sizeof(expected); i++)
+    {
+        CHECK_EQ(sim_spiBytes[i], expected[i]);
+    }
+    CHECK_EQ(doneCalls, 1);
+    CHECK(!spi1_dmaBusy());
+    CHECK(!SPI1CON1Lbits.SPIEN);
+    /* a late poll must not report the same transfer twice */
+    spi1_dmaWait();
+    _DMA0Interrupt();
+    CHECK_EQ(doneCalls, 1);
+}
+
+static void testFillWords(void)
+{
+    uint16_t i;
+
+    resetBus();
+    CHECK(!spi1_dmaFillWords(0xF81F, 0));
+    CHECK(spi1_dmaFillWords(0xF81F, 300));
+    CHECK_EQ(DMACNT0, 300);
+    CHECK_EQ(DMACH0bits.SAMODE, 0);
+
+    /* completion seen by polling with the interrupt masked */
+    IEC0bits.DMA0IE = 0;
+    sim_dmaRun();
+    CHECK_EQ(doneCalls, 0);
+    spi1_dmaWait();
+    CHECK_EQ(doneCalls, 1);
+    CHECK_EQ(sim_spiByteCount, 600);
+    for(i = 0; i < 600; i += 2)
+    {
+        CHECK_EQ(sim_spiBytes[i], 0xF8);
+        CHECK_EQ(sim_spiBytes[i + 1], 0x1F);
+    }
+    CHECK(!spi1_dmaBusy());
+}
+
+static void testBackToBack(void)
+{
+    uint16_t first[] = {0x0102};
+    uint16_t second[] = {0x0304, 0x0506};
+
+    resetBus();
+    CHECK(spi1_dmaWriteWords(first, 1));
+    finishTransfer();
+    CHECK(spi1_dmaWriteWords(second, 2));
+    finishTransfer();
+    CHECK_EQ(doneCalls, 2);
+    CHECK_EQ(sim_spiByteCount, 6);
+    CHECK_EQ(sim_spiBytes[0], 0x01);
+    CHECK_EQ(sim_spiBytes[5], 0x06);
+}
+
+static const uint16_t flashWords[] = {0x1234, 0x5678};
+
+static void testOutOfRange(void)
+{
+    uint16_t words[2];
+
+    resetBus();
+    sim_dmaMapFlash(flashWords, sizeof(flashWords));
+    CHECK(!spi1_dmaCanRead(flashWords, 2));
+    CHECK(!spi1_dmaWriteWords(flashWords, 2));
+    CHECK(!spi1_dmaBusy());
+    CHECK(spi1_dmaCanRead(words, 2));
+    sim_dmaMapFlash(NULL, 0);
+}
+
+int main(void)
+{
+    testWriteWords();
+    testFillWords();
+    testBackToBack();
+    testOutOfRange();
+    return CHECK_DONE();
+}
@@ -0,0 +1,193 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Sprites of the committed atlas (oledDriver/oledC_atlasData.c, built by
+ * tools/atlasc.py from tools/sprites/) over a checkered background: on and
+ * across every panel edge, fully off screen and through a viewport. Every
+ * pixel must be the source icon where it is opaque and the background
+ * where it is transparent or outside the icon; the framebuffer target must
+ * give the same frame, which must match golden/sprites.ppm. */
+
+#include <stdio.h>
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "../oledDriver/oledC_framebuffer.h"
+#include "../oledDriver/oledC_atlasData.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define ICON_PIXELS 256
+#define KEY 0xF81F
+#define SQUARE_A 0x2104
+#define SQUARE_B 0x0010
+
+int check_failures;
+
+static const char *const iconFiles[] = {
+    "../tools/sprites/battery.ppm",
+    "../tools/sprites/bell.ppm",
+    "../tools/sprites/heart.ppm",
+};
+
+#define ICONS (sizeof(iconFiles) / sizeof(iconFiles[0]))
+
+static uint16_t icons[ICONS][ICON_PIXELS];
+static uint8_t iconWidth[ICONS], iconHeight[ICONS];
+
+typedef struct
+{
+    int16_t x, y;
+    uint8_t index;
+} placement_t;
+
+/* every edge and corner, one visible and one far off screen */
+static const placement_t placements[] = {
+    {-5, -3, OLEDC_SPRITE_WATCH_BELL},
+    {40, -6, OLEDC_SPRITE_WATCH_BATTERY},
+    {88, 12, OLEDC_SPRITE_WATCH_HEART},
+    {-7, 50, OLEDC_SPRITE_WATCH_HEART},
+    {30, 90, OLEDC_SPRITE_WATCH_BELL},
+    {86, 91, OLEDC_SPRITE_WATCH_BATTERY},
+    {30, 30, OLEDC_SPRITE_WATCH_BATTERY},
+    {50, 40, OLEDC_SPRITE_WATCH_BELL},
+    {-40, 20, OLEDC_SPRITE_WATCH_HEART},
+    {300, 20, OLEDC_SPRITE_WATCH_HEART},
+};
+
+#define PLACEMENTS (sizeof(placements) / sizeof(placements[0]))
+
+/* drawn through a viewport at (60, 60) that clips at 20x20 */
+static const placement_t inViewport = {12, 14, OLEDC_SPRITE_WATCH_BELL};
+
+static uint16_t background(uint8_t x, uint8_t y)
+{
+    return ((x >> 3) + (y >> 3)) & 1 ? SQUARE_A : SQUARE_B;
+}
+
+static void drawBackground(void)
+{
+    uint8_t x, y;
+    for(y = 0; y < SIZE; y += 8)
+    {
+        for(x = 0; x < SIZE; x += 8)
+        {
+            oledC_DrawRectangle(x, y, x + 7, y + 7, background(x, y));
+        }
+    }
+}
+
+static void drawScene(void)
+{
+    uint8_t i;
+    drawBackground();
+    for(i = 0; i < PLACEMENTS; i++)
+    {
+        oledC_DrawSprite(placements[i].x, placements[i].y, &oledC_atlas_watch, placements[i].index);
+    }
+    /* an index past the atlas draws nothing */
+    oledC_DrawSprite(10, 10, &oledC_atlas_watch, oledC_atlas_watch.count);
+    oledC_pushViewport(60, 60, 20, 20);
+    oledC_DrawSprite(inViewport.x, inViewport.y, &oledC_atlas_watch, inViewport.index);
+    oledC_popViewport();
+}
+
+static void paint(uint16_t *frame, const placement_t *p, int16_t clipXs, int16_t clipYs, int16_t clipXe, int16_t clipYe)
+{
+    int16_t ix, iy, sx, sy;
+    for(iy = 0; iy < iconHeight[p->index]; iy++)
+    {
+        for(ix = 0; ix < iconWidth[p->index]; ix++)
+        {
+            uint16_t color = icons[p->index][iy * iconWidth[p->index] + ix];
+            sx = p->x + ix;
+            sy = p->y + iy;
+            if(color != KEY && sx >= clipXs && sx <= clipXe && sy >= clipYs && sy <= clipYe)
+            {
+                frame[sy * SIZE + sx] = color;
+            }
+        }
+    }
+}
+
+static void expectedScene(uint16_t *frame)
+{
+    placement_t shifted = inViewport;
+    uint8_t x, y, i;
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            frame[y * SIZE + x] = background(x, y);
+        }
+    }
+    for(i = 0; i < PLACEMENTS; i++)
+    {
+        paint(frame, &placements[i], 0, 0, SIZE - 1, SIZE - 1);
+    }
+    shifted.x += 60;
+    shifted.y += 60;
+    paint(frame, &shifted, 60, 60, 79, 79);
+}
+
+static void testAtlas(void)
+{
+    uint8_t i;
+    CHECK_EQ(oledC_atlas_watch.count, ICONS);
+    for(i = 0; i < ICONS; i++)
+    {
+        CHECK(sim_readPpm(iconFiles[i], icons[i], ICON_PIXELS, &iconWidth[i], &iconHeight[i]));
+        CHECK_EQ(oledC_atlas_watch.sprites[i].width, iconWidth[i]);
+        CHECK_EQ(oledC_atlas_watch.sprites[i].height, iconHeight[i]);
+    }
+}
+
+int main(void)
+{
+    static uint16_t expected[SIZE * SIZE], onPanel[SIZE * SIZE], buffered[SIZE * SIZE];
+    uint8_t x, y;
+
+    testAtlas();
+    expectedScene(expected);
+
+    sim_panelStart(0);
+    drawScene();
+    sim_panelSnapshot(onPanel);
+    CHECK_EQ(sim_countDiff(onPanel, expected), 0);
+    CHECK_EQ(sim_strayBytes, 0);
+
+    oledC_setDrawTarget(OLEDC_TARGET_FRAMEBUFFER);
+    drawScene();
+    oledC_setDrawTarget(OLEDC_TARGET_PANEL);
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            buffered[y * SIZE + x] = oledC_fbGetPixel(x, y);
+        }
+    }
+    CHECK_EQ(sim_countDiff(buffered, expected), 0);
+
+    sim_writePpm("build/sprites.ppm", onPanel);
+    CHECK(sim_ppmMatches("golden/sprites.ppm", onPanel));
+    return CHECK_DONE();
+}
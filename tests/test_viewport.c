@@ -0,0 +1,224 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Viewport stack: nested viewports add their origins and intersect their
+ * clips, pushClip keeps the origin, clips stop at the panel edges and at
+ * negative origins, and a full stack refuses the push without changing the
+ * current viewport. Clipped drawing must equal the unclipped drawing masked
+ * to the clip rectangle. */
+
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_shapes.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+#define SIZE SIM_SCREEN_SIZE
+#define BG 0x0000
+#define FG 0xF800
+
+int check_failures;
+
+static uint16_t reference[SIZE * SIZE];
+static uint16_t clipped[SIZE * SIZE];
+
+static void start(void)
+{
+    oledC_resetViewport();
+    sim_panelStart(BG);
+}
+
+/* pixels equal to FG must be exactly the screen rectangle given, none for
+ * an empty one */
+static uint16_t countOutsideRect(int16_t xs, int16_t ys, int16_t xe, int16_t ye)
+{
+    uint8_t x, y;
+    uint16_t bad = 0;
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            bool inside = x >= xs && x <= xe && y >= ys && y <= ye;
+            bad += inside != (sim_panelPixel(x, y) == FG);
+        }
+    }
+    return bad;
+}
+
+static void checkClip(int16_t xs, int16_t ys, int16_t xe, int16_t ye)
+{
+    int16_t cxs, cys, cxe, cye;
+    oledC_getClip(&cxs, &cys, &cxe, &cye);
+    CHECK_EQ(cxs, xs);
+    CHECK_EQ(cys, ys);
+    CHECK_EQ(cxe, xe);
+    CHECK_EQ(cye, ye);
+}
+
+static void testNesting(void)
+{
+    start();
+    CHECK(oledC_pushViewport(10, 10, 50, 50));
+    checkClip(0, 0, 49, 49);
+    CHECK(oledC_pushViewport(5, 5, 20, 20));
+    /* origin (15, 15), clip 15..34 on screen */
+    checkClip(0, 0, 19, 19);
+    oledC_DrawRectangle(0, 0, 95, 95, FG);
+    CHECK_EQ(countOutsideRect(15, 15, 34, 34), 0);
+
+    /* a child larger than its parent is cut to the parent */
+    CHECK(oledC_pushViewport(10, 10, 60, 60));
+    checkClip(0, 0, 9, 9);
+    oledC_popViewport();
+    oledC_popViewport();
+    checkClip(0, 0, 49, 49);
+
+    /* pushClip intersects without moving the origin */
+    start();
+    CHECK(oledC_pushViewport(20, 20, 40, 40));
+    CHECK(oledC_pushClip(10, 12, 5, 6));
+    checkClip(10, 12, 14, 17);
+    oledC_DrawRectangle(0, 0, 95, 95, FG);
+    CHECK_EQ(countOutsideRect(30, 32, 34, 37), 0);
+    oledC_popViewport();
+    oledC_popViewport();
+    checkClip(0, 0, 95, 95);
+}
+
+static void testPanelEdges(void)
+{
+    uint8_t screen_x, screen_y;
+
+    /* a viewport hanging over the right and bottom edges stops at 95 */
+    start();
+    CHECK(oledC_pushViewport(80, 84, 40, 40));
+    checkClip(0, 0, 15, 11);
+    oledC_DrawRectangle(0, 0, 39, 39, FG);
+    CHECK_EQ(countOutsideRect(80, 84, 95, 95), 0);
+    /* nothing wraps into the hidden GRAM columns */
+    CHECK_EQ(sim_gram[84][SIM_COLUMN_OFFSET + 96], BG);
+    CHECK_EQ(sim_strayBytes, 0);
+
+    /* streaming writers get a window only when all of it is visible */
+    CHECK(oledC_viewportWindow(2, 3, 14, 9, &screen_x, &screen_y));
+    CHECK_EQ(screen_x, 82);
+    CHECK_EQ(screen_y, 87);
+    CHECK(!oledC_viewportWindow(2, 3, 15, 9, &screen_x, &screen_y));
+    CHECK(!oledC_viewportWindow(0, 0, 0, 1, &screen_x, &screen_y));
+
+    /* an empty viewport draws nothing */
+    start();
+    CHECK(oledC_pushClip(10, 10, 0, 20));
+    oledC_DrawRectangle(0, 0, 95, 95, FG);
+    oledC_DrawPoint(10, 10, FG);
+    CHECK_EQ(countOutsideRect(1, 1, 0, 0), 0);
+    oledC_popViewport();
+}
+
+static void testNegativeOrigin(void)
+{
+    start();
+    CHECK(oledC_pushViewport(-10, -20, 40, 40));
+    /* local coordinates left of and above the panel are clipped away */
+    checkClip(10, 20, 39, 39);
+    oledC_DrawRectangle(0, 0, 95, 95, FG);
+    CHECK_EQ(countOutsideRect(0, 0, 29, 19), 0);
+
+    start();
+    CHECK(oledC_pushViewport(-10, -20, 40, 40));
+    oledC_DrawPoint(5, 5, FG);
+    CHECK_EQ(countOutsideRect(1, 1, 0, 0), 0);
+    oledC_DrawPoint(12, 22, FG);
+    CHECK_EQ(countOutsideRect(2, 2, 2, 2), 0);
+    oledC_popViewport();
+}
+
+/* the same scene drawn shifted by the origin; only the clip may differ */
+static void drawScene(uint8_t dx, uint8_t dy)
+{
+    oledC_DrawCircle(20 + dx, 20 + dy, 18, FG);
+    oledC_DrawRing(70 + dx, 30 + dy, 25, 4, 0x07E0);
+    oledC_DrawLine(0 + dx, 90 + dy, 95 + dx, 5 + dy, 3, 0x001F);
+    oledC_DrawString(2 + dx, 60 + dy, 2, 2, (uint8_t *)"CLIP", 0xFFFF);
+}
+
+static void testClippedScene(void)
+{
+    uint16_t x, y, bad = 0;
+
+    start();
+    drawScene(0, 0);
+    sim_panelSnapshot(reference);
+
+    /* origin at (-12, -7), clip 5..70 x 3..50 on screen */
+    start();
+    CHECK(oledC_pushViewport(-12, -7, 120, 120));
+    CHECK(oledC_pushClip(17, 10, 66, 48));
+    drawScene(12, 7);
+    sim_panelSnapshot(clipped);
+    for(y = 0; y < SIZE; y++)
+    {
+        for(x = 0; x < SIZE; x++)
+        {
+            bool inside = x >= 5 && x <= 70 && y >= 3 && y <= 50;
+            bad += clipped[y * SIZE + x] != (inside ? reference[y * SIZE + x] : BG);
+        }
+    }
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(sim_strayBytes, 0);
+}
+
+static void testOverflow(void)
+{
+    uint8_t i;
+    start();
+    for(i = 0; i < OLEDC_VIEWPORT_DEPTH; i++)
+    {
+        CHECK(oledC_pushViewport(1, 1, 90, 90));
+    }
+    checkClip(0, 0, 89 - OLEDC_VIEWPORT_DEPTH + 1, 89 - OLEDC_VIEWPORT_DEPTH + 1);
+    /* a full stack keeps the innermost viewport */
+    CHECK(!oledC_pushViewport(50, 50, 5, 5));
+    CHECK(!oledC_pushClip(0, 0, 1, 1));
+    checkClip(0, 0, 89 - OLEDC_VIEWPORT_DEPTH + 1, 89 - OLEDC_VIEWPORT_DEPTH + 1);
+    oledC_DrawRectangle(0, 0, 95, 95, FG);
+    CHECK_EQ(countOutsideRect(OLEDC_VIEWPORT_DEPTH, OLEDC_VIEWPORT_DEPTH, 90, 90), 0);
+
+    /* popping past the root is harmless */
+    for(i = 0; i < OLEDC_VIEWPORT_DEPTH + 2; i++)
+    {
+        oledC_popViewport();
+    }
+    checkClip(0, 0, 95, 95);
+    CHECK(oledC_pushViewport(1, 1, 90, 90));
+    oledC_resetViewport();
+    checkClip(0, 0, 95, 95);
+}
+
+int main(void)
+{
+    testNesting();
+    testPanelEdges();
+    testNegativeOrigin();
+    testClippedScene();
+    testOverflow();
+    return CHECK_DONE();
+}
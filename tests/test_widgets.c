@@ -0,0 +1,140 @@
+ /*
+     (c) 2016 Microchip Technology Inc. and its subsidiaries. You may use this
+    software and any derivatives exclusively with Microchip products.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+    WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+    BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+    FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+    ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+    THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+
+    MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+    TERMS.
+ */
+
+/* Widget layer bus traffic: bytes sent to the panel per oledC_uiFlush().
+ * A frame where nothing visible changed must send nothing, and a changed
+ * widget must cost no more than repainting its own area. */
+
+#include "../oledDriver/oledC.h"
+#include "../oledDriver/oledC_widgets.h"
+#include "sim/sim_panel.h"
+#include "sim/check.h"
+
+int check_failures;
+
+/* 2 bytes per pixel for each layer painted over the area, with slack for
+ * the commands and address windows of the repaint */
+#define REPAINT_BYTES(w, h, layers) (2UL * (w) * (h) * (layers) + 64)
+
+static oledC_widget_t row, hours, colon, minutes, bar, status;
+
+static uint32_t flushBytes(void)
+{
+    sim_panelCountReset();
+    oledC_uiFlush();
+    return sim_dataBytes + sim_commandBytes;
+}
+
+static void setupFace(void)
+{
+    sim_panelStart(0);
+    initShapesMem();
+    oledC_uiInit(0x0000);
+    oledC_uiContainer(&row, NULL, 2, 2, OLEDC_UI_ROW, 1);
+    oledC_uiCounter(&hours, &row, 0, 0, 2, 2, 0xFFFF);
+    oledC_uiLabel(&colon, &row, 0, 0, 2, ":", 0xFFFF);
+    oledC_uiCounter(&minutes, &row, 0, 0, 2, 2, 0xFFFF);
+    oledC_uiBar(&bar, NULL, 4, 40, 80, 6, 60, 0x07E0, 0x4208);
+    oledC_uiLabel(&status, NULL, 4, 60, 1, "ok", 0xFFE0);
+}
+
+static void testIdleFrames(void)
+{
+    uint32_t bytes;
+    setupFace();
+    bytes = flushBytes();
+    printf("first frame: %lu bytes\n", (unsigned long)bytes);
+    CHECK(bytes > 0);
+    CHECK_EQ(flushBytes(), 0);
+
+    /* setting what is already shown changes nothing */
+    oledC_uiSetValue(&minutes, 0);
+    oledC_uiSetText(&status, "ok");
+    oledC_uiSetColor(&hours, 0xFFFF);
+    CHECK_EQ(flushBytes(), 0);
+}
+
+static void testTick(void)
+{
+    uint32_t bytes;
+    setupFace();
+    flushBytes();
+    oledC_uiSetValue(&minutes, 1);
+    bytes = flushBytes();
+    printf("minute tick: %lu bytes\n", (unsigned long)bytes);
+    CHECK(bytes > 0);
+    /* the text cells (6 x 9 pixels a character at scale 1) over the
+     * background */
+    CHECK(bytes <= REPAINT_BYTES(2 * 12, 2 * 9, 2));
+}
+
+/* an empty bar has its fill hidden: changing the fill colour is invisible */
+static void testHiddenFill(void)
+{
+    uint32_t bytes;
+    setupFace();
+    flushBytes();
+    oledC_uiSetColor(&bar, 0xF800);
+    CHECK_EQ(flushBytes(), 0);
+
+    oledC_uiSetValue(&bar, 15);
+    bytes = flushBytes();
+    CHECK(bytes > 0);
+    CHECK(bytes <= REPAINT_BYTES(20, bar.height, 1));
+    CHECK_EQ(sim_panelPixel(bar.x + 5, bar.y + 1), 0xF800);
+
+    oledC_uiSetValue(&bar, 0);
+    CHECK(flushBytes() <= REPAINT_BYTES(20, bar.height, 1));
+    CHECK_EQ(sim_panelPixel(bar.x + 5, bar.y + 1), 0x4208);
+    oledC_uiSetColor(&bar, 0x001F);
+    CHECK_EQ(flushBytes(), 0);
+}
+
+/* with the palette full a widget's colour is substituted; re-rendering it
+ * with the same request must not count as a change */
+static void testSubstitutedColor(void)
+{
+    static oledC_widget_t fillers[16];
+    char text[2] = "a";
+    uint8_t i;
+    setupFace();
+    for(i = 0; i < 16; i++)
+    {
+        oledC_uiLabel(&fillers[i], NULL, (i % 8) * 10, 70 + (i / 8) * 10, 1, text, 0x1000 + i * 0x0841);
+    }
+    oledC_uiSetColor(&status, 0xF81F);
+    flushBytes();
+    oledC_uiSetText(&status, "ok");
+    oledC_uiSetColor(&status, 0xF81F);
+    oledC_uiSetValue(&minutes, 0);
+    CHECK_EQ(flushBytes(), 0);
+}
+
+int main(void)
+{
+    testIdleFrames();
+    testTick();
+    testHiddenFill();
+    testSubstitutedColor();
+    CHECK_EQ(sim_strayBytes, 0);
+    return CHECK_DONE();
+}
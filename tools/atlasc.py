@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Pack PPM icons into an oledC_atlas_t sprite atlas.
+
+Usage: atlasc.py [--key RRGGBB] atlas_name out_base icon.ppm [icon.ppm ...]
+
+Pixels of the key colour (magenta FF00FF by default) are transparent. All
+icons share one palette of at most 15 RGB565 colours plus the transparent
+index. The sprite index of every icon is exported as
+OLEDC_SPRITE_<ATLAS>_<FILE NAME> in out_base.h.
+"""
+import os
+import sys
+
+from imgc import read_ppm, rgb565
+
+
+def pack_sprite(width, colors, palette, key):
+    data = []
+    for y in range(len(colors) // width):
+        row = colors[y * width:(y + 1) * width]
+        indices = [15 if c == key else palette.index(c) for c in row]
+        if len(indices) % 2:
+            indices.append(15)
+        data += [(indices[i] << 4) | indices[i + 1] for i in range(0, len(indices), 2)]
+    return data
+
+
+def main(argv):
+    args = argv[1:]
+    key = (0xFF, 0x00, 0xFF)
+    if args[:1] == ["--key"]:
+        value = int(args[1], 16)
+        key = (value >> 16, (value >> 8) & 0xFF, value & 0xFF)
+        args = args[2:]
+    if len(args) < 3:
+        sys.stderr.write(__doc__)
+        return 1
+    name, base, paths = args[0], args[1], args[2:]
+    key565 = rgb565(*key)
+    icons = []
+    palette = []
+    for path in paths:
+        width, height, pixels = read_ppm(path)
+        if width > 96 or height > 96:
+            raise ValueError("%s is larger than the panel" % path)
+        colors = [rgb565(*p) for p in pixels]
+        for c in colors:
+            if c != key565 and c not in palette:
+                palette.append(c)
+        icons.append((os.path.splitext(os.path.basename(path))[0], width, height, colors))
+    if len(palette) > 15:
+        raise ValueError("%d colours, at most 15 plus transparency" % len(palette))
+    transparent = 15
+    palette += [0] * (16 - len(palette))
+
+    infos, pixels = [], []
+    for icon, width, height, colors in icons:
+        infos.append((width, height, len(pixels)))
+        pixels += pack_sprite(width, colors, palette, key565)
+    if len(pixels) > 0xFFFF:
+        raise ValueError("atlas data exceeds 64 KB")
+
+    guard = os.path.basename(base).upper() + "_H"
+    note = "/* Generated by tools/atlasc.py, do not edit */"
+    h = [note, "", "#ifndef %s" % guard, "#define\t%s" % guard, "",
+         '#include "oledC_sprite.h"', ""]
+    for i, (icon, _, _, _) in enumerate(icons):
+        ident = "".join(ch if ch.isalnum() else "_" for ch in icon).upper()
+        h.append("#define OLEDC_SPRITE_%s_%s %d" % (name.upper(), ident, i))
+    h += ["", "extern const oledC_atlas_t oledC_atlas_%s;" % name, "",
+          "#endif\t/* %s */" % guard, ""]
+    c = [note, "", "#include <stdint.h>", '#include "%s.h"' % os.path.basename(base), "",
+         "static const uint16_t %s_palette[16] = {" % name,
+         "    " + ",".join("0x%04X" % v for v in palette) + ",", "};",
+         "static const oledC_spriteInfo_t %s_sprites[%d] = {" % (name, len(infos))]
+    c += ["    {%d, %d, %d}," % info for info in infos]
+    c += ["};", "static const uint8_t %s_pixels[%d] = {" % (name, len(pixels))]
+    for i in range(0, len(pixels), 16):
+        c.append("    " + ",".join("0x%02X" % b for b in pixels[i:i + 16]) + ",")
+    c += ["};", "",
+          "const oledC_atlas_t oledC_atlas_%s = {" % name,
+          "    %d, %d, %s_palette, %s_sprites, %s_pixels," % (len(infos), transparent, name, name, name),
+          "};", ""]
+    with open(base + ".h", "w") as f:
+        f.write("\n".join(h))
+    with open(base + ".c", "w") as f:
+        f.write("\n".join(c))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""Compile glyph sources into packed oledC_font_t tables.
+
+Usage: fontc.py fonts.txt out_base
+
+fonts.txt lists one font per line:
+    <name> <source> [proportional] [scale=N] [chars=<set>] [spacing=N]
+where <source> is a text glyph file (see fonts/oledc_5x8.txt) or a BDF file,
+relative to fonts.txt. chars takes single characters and ranges such as
+"0-9:". The tool writes out_base.c with the tables and out_base.h with
+one extern oledC_font_t per font.
+
+Glyphs are stored column by column, ceil(height / 8) bytes per column with
+bit 0 of the first byte at the top row, which is the order the panel takes
+pixels in vertical increment mode.
+"""
+import os
+import sys
+
+
+def parse_text(path):
+    height = None
+    glyphs = {}
+    code = None
+    rows = []
+
+    def finish():
+        if code is not None:
+            if len(rows) != height:
+                raise ValueError("%s: glyph 0x%02X has %d rows, expected %d"
+                                 % (path, code, len(rows), height))
+            glyphs[code] = rows[:]
+
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#") and not set(line) <= set("#."):
+                continue
+            if line.startswith("height"):
+                height = int(line.split()[1])
+            elif line.startswith("glyph"):
+                finish()
+                code = int(line.split()[1], 0)
+                rows = []
+            else:
+                rows.append([c == "#" for c in line])
+    finish()
+    return height, glyphs
+
+
+def parse_bdf(path):
+    height = ascent = None
+    glyphs = {}
+    with open(path) as f:
+        lines = [l.strip() for l in f]
+    i = 0
+    while i < len(lines):
+        words = lines[i].split()
+        i += 1
+        if not words:
+            continue
+        if words[0] == "FONTBOUNDINGBOX":
+            height = int(words[2])
+            ascent = int(words[2]) + int(words[4])
+        elif words[0] == "STARTCHAR":
+            code = width = None
+            bbx = (0, 0, 0, 0)
+            while not lines[i].startswith("BITMAP"):
+                words = lines[i].split()
+                if words[0] == "ENCODING":
+                    code = int(words[1])
+                elif words[0] == "DWIDTH":
+                    width = int(words[1])
+                elif words[0] == "BBX":
+                    bbx = tuple(int(w) for w in words[1:5])
+                i += 1
+            i += 1
+            bw, bh, bx, by = bbx
+            width = max(width or 0, bx + bw)
+            rows = [[False] * width for _ in range(height)]
+            top = ascent - (by + bh)
+            for r in range(bh):
+                bits = int(lines[i + r], 16)
+                nbits = len(lines[i + r]) * 4
+                for c in range(bw):
+                    y = top + r
+                    if 0 <= y < height and bits & (1 << (nbits - 1 - c)):
+                        rows[y][bx + c] = True
+            i += bh
+            if code is not None and 0 <= code < 256:
+                glyphs[code] = rows
+    return height, glyphs
+
+
+def parse_chars(spec):
+    chars = set()
+    i = 0
+    while i < len(spec):
+        if i + 2 < len(spec) and spec[i + 1] == "-":
+            chars.update(range(ord(spec[i]), ord(spec[i + 2]) + 1))
+            i += 3
+        else:
+            chars.add(ord(spec[i]))
+            i += 1
+    return chars
+
+
+def crop(rows, height):
+    width = len(rows[0]) if rows else 0
+    used = [c for c in range(width) if any(rows[r][c] for r in range(height))]
+    if not used:
+        return [row[:(width + 1) // 2] for row in rows]
+    return [row[used[0]:used[-1] + 1] for row in rows]
+
+
+def scale(rows, factor):
+    out = []
+    for row in rows:
+        wide = [bit for bit in row for _ in range(factor)]
+        out.extend([wide[:] for _ in range(factor)])
+    return out
+
+
+def pack(rows, height):
+    data = []
+    width = len(rows[0]) if rows else 0
+    for c in range(width):
+        for base in range(0, height, 8):
+            byte = 0
+            for b in range(min(8, height - base)):
+                if rows[base + b][c]:
+                    byte |= 1 << b
+            data.append(byte)
+    return data
+
+
+def compile_font(name, source, options):
+    if source.lower().endswith(".bdf"):
+        height, glyphs = parse_bdf(source)
+    else:
+        height, glyphs = parse_text(source)
+    factor = int(options.get("scale", 1))
+    if "chars" in options:
+        wanted = parse_chars(options["chars"])
+        glyphs = {c: g for c, g in glyphs.items() if c in wanted}
+    if "proportional" in options:
+        glyphs = {c: crop(g, height) for c, g in glyphs.items()}
+    if factor > 1:
+        glyphs = {c: scale(g, factor) for c, g in glyphs.items()}
+        height *= factor
+    if not glyphs:
+        raise ValueError("font %s has no glyphs" % name)
+    if height > 96:
+        raise ValueError("font %s is taller than the panel" % name)
+    first, last = min(glyphs), max(glyphs)
+    widths, offsets, bitmap = [], [], []
+    for code in range(first, last + 1):
+        rows = glyphs.get(code)
+        offsets.append(len(bitmap))
+        widths.append(len(rows[0]) if rows else 0)
+        if rows:
+            bitmap.extend(pack(rows, height))
+    return {
+        "name": name,
+        "height": height,
+        "first": first,
+        "count": last - first + 1,
+        "spacing": int(options.get("spacing", factor)),
+        "widths": widths,
+        "offsets": offsets,
+        "bitmap": bitmap,
+    }
+
+
+def c_array(ctype, name, values, per_line=16):
+    lines = ["static const %s %s[%d] = {" % (ctype, name, len(values))]
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        fmt = "0x%02X" if ctype == "uint8_t" else "%d"
+        lines.append("    " + ",".join(fmt % v for v in chunk) + ",")
+    lines.append("};")
+    return lines
+
+
+def write_sources(fonts, base, manifest):
+    guard = os.path.basename(base).upper() + "_H"
+    header = os.path.basename(base) + ".h"
+    note = "/* Generated by tools/fontc.py from %s, do not edit */" % manifest
+    h = [note, "", "#ifndef %s" % guard, "#define\t%s" % guard, "",
+         '#include "oledC_font.h"', ""]
+    c = [note, "", "#include <stdint.h>", '#include "%s"' % header, ""]
+    for font in fonts:
+        n = font["name"]
+        h.append("extern const oledC_font_t oledC_font_%s;" % n)
+        c += c_array("uint8_t", "%s_widths" % n, font["widths"])
+        c += c_array("uint16_t", "%s_offsets" % n, font["offsets"], 12)
+        c += c_array("uint8_t", "%s_bitmap" % n, font["bitmap"])
+        c += ["",
+              "const oledC_font_t oledC_font_%s = {" % n,
+              "    %d, 0x%02X, %d, %d," % (font["height"], font["first"],
+                                          font["count"], font["spacing"]),
+              "    %s_widths, %s_offsets, %s_bitmap," % (n, n, n),
+              "};", ""]
+    h += ["", "#endif\t/* %s */" % guard, ""]
+    with open(base + ".h", "w") as f:
+        f.write("\n".join(h))
+    with open(base + ".c", "w") as f:
+        f.write("\n".join(c))
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write(__doc__)
+        return 1
+    manifest, base = argv[1], argv[2]
+    root = os.path.dirname(manifest)
+    fonts = []
+    with open(manifest) as f:
+        for line in f:
+            words = line.split("#", 1)[0].split()
+            if not words:
+                continue
+            options = {}
+            for word in words[2:]:
+                key, _, value = word.partition("=")
+                options[key] = value
+            fonts.append(compile_font(words[0], os.path.join(root, words[1]), options))
+    write_sources(fonts, base, os.path.basename(manifest))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Encode a binary PPM (P6) image as an oledC_image_t palette RLE table.
+
+Usage: imgc.py image.ppm name out_base
+
+Colours are reduced to RGB565 and may use at most 16 distinct values.
+Writes out_base.c and out_base.h declaring oledC_image_<name>.
+See oledDriver/oledC_image.h for the run format.
+"""
+import os
+import sys
+
+
+def read_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos) + 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(data[start:pos])
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise ValueError("only 8-bit binary PPM (P6) is supported")
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[pos + 1:pos + 1 + width * height * 3]
+    return width, height, [tuple(pixels[i:i + 3]) for i in range(0, len(pixels), 3)]
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def encode(colors):
+    palette = []
+    for c in colors:
+        if c not in palette:
+            palette.append(c)
+    if len(palette) > 16:
+        raise ValueError("%d colours, at most 16 are supported" % len(palette))
+    data = []
+    i = 0
+    while i < len(colors):
+        run = 1
+        while i + run < len(colors) and colors[i + run] == colors[i] and run < 271:
+            run += 1
+        index = palette.index(colors[i]) << 4
+        if run < 16:
+            data.append(index | (run - 1))
+        else:
+            data += [index | 0x0F, run - 16]
+        i += run
+    return palette, data
+
+
+def write_sources(name, width, height, palette, data, base, source):
+    guard = os.path.basename(base).upper() + "_H"
+    note = "/* Generated by tools/imgc.py from %s, do not edit */" % source
+    with open(base + ".h", "w") as f:
+        f.write("\n".join([note, "", "#ifndef %s" % guard, "#define\t%s" % guard, "",
+                           '#include "oledC_image.h"', "",
+                           "extern const oledC_image_t oledC_image_%s;" % name, "",
+                           "#endif\t/* %s */" % guard, ""]))
+    lines = [note, "", "#include <stdint.h>", '#include "%s.h"' % os.path.basename(base), "",
+             "static const uint16_t %s_palette[%d] = {" % (name, len(palette)),
+             "    " + ",".join("0x%04X" % c for c in palette) + ",", "};",
+             "static const uint8_t %s_data[%d] = {" % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ",".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    lines += ["};", "",
+              "const oledC_image_t oledC_image_%s = {" % name,
+              "    %d, %d, %s_palette, %s_data, %d," % (width, height, name, name, len(data)),
+              "};", ""]
+    with open(base + ".c", "w") as f:
+        f.write("\n".join(lines))
+
+
+def main(argv):
+    if len(argv) != 4:
+        sys.stderr.write(__doc__)
+        return 1
+    width, height, pixels = read_ppm(argv[1])
+    if width > 96 or height > 96:
+        raise ValueError("image is larger than the panel")
+    palette, data = encode([rgb565(*p) for p in pixels])
+    write_sources(argv[2], width, height, palette, data, argv[3], os.path.basename(argv[1]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+"""Decode an oledC_screenshot() stream into a binary PPM image.
+
+Usage: oledc_screenshot.py capture.bin out.ppm
+"""
+import sys
+
+
+def decode(data):
+    if data[:4] != b"OLS1":
+        raise ValueError("not an OLS1 screenshot stream")
+    width, height = data[4], data[5]
+    pixels = []
+    pos = 6
+    while len(pixels) < width * height:
+        if pos + 3 > len(data):
+            raise ValueError("truncated stream")
+        length = data[pos] + 1
+        color = (data[pos + 1] << 8) | data[pos + 2]
+        pixels.extend([color] * length)
+        pos += 3
+    return width, height, pixels[:width * height]
+
+
+def rgb565_to_rgb888(color):
+    r = (color >> 11) & 0x1F
+    g = (color >> 5) & 0x3F
+    b = color & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def to_ppm(width, height, pixels):
+    body = bytearray()
+    for color in pixels:
+        body.extend(rgb565_to_rgb888(color))
+    return b"P6\n%d %d\n255\n" % (width, height) + bytes(body)
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write(__doc__)
+        return 1
+    with open(argv[1], "rb") as f:
+        width, height, pixels = decode(f.read())
+    with open(argv[2], "wb") as f:
+        f.write(to_ppm(width, height, pixels))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))